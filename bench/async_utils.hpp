@@ -0,0 +1,35 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+
+#include <future>
+
+#include "ntgcalls/utils/binding_utils.hpp"
+
+namespace bench {
+    // Blocks until an NTgCalls promise settles, rethrowing its exception if it was rejected
+    template <typename T>
+    T await(AsyncPromise<T> promise) {
+        std::promise<T> result;
+        auto future = result.get_future();
+        promise.then([&result](T value) {
+            result.set_value(std::move(value));
+        }, [&result](const std::exception_ptr& e) {
+            result.set_exception(e);
+        });
+        return future.get();
+    }
+
+    inline void await(const AsyncPromise<void>& promise) {
+        std::promise<void> result;
+        auto future = result.get_future();
+        promise.then([&result] {
+            result.set_value();
+        }, [&result](const std::exception_ptr& e) {
+            result.set_exception(e);
+        });
+        future.get();
+    }
+} // bench
@@ -0,0 +1,95 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include "bench_utils.hpp"
+
+#include <random>
+
+namespace bench {
+    bytes::binary randomBinary(const size_t size) {
+        static std::mt19937 generator(42);
+        std::uniform_int_distribution<int> distribution(0, 255);
+        bytes::binary result(size);
+        for (auto& byte : result) {
+            byte = static_cast<uint8_t>(distribution(generator));
+        }
+        return result;
+    }
+
+    std::string randomString(const size_t size) {
+        static constexpr char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+        static std::mt19937 generator(7);
+        std::uniform_int_distribution<size_t> distribution(0, sizeof(alphabet) - 2);
+        std::string result(size, ' ');
+        for (auto& c : result) {
+            c = alphabet[distribution(generator)];
+        }
+        return result;
+    }
+
+    signaling::EncryptionKey encryptionKey(const bool isOutgoing) {
+        static const auto key = [] {
+            auto value = std::make_shared<std::array<uint8_t, signaling::EncryptionKey::kSize>>();
+            const auto random = randomBinary(value->size());
+            std::ranges::copy(random, value->begin());
+            return value;
+        }();
+        return {key, isOutgoing};
+    }
+
+    std::string offerSdp() {
+        return "v=0\r\n"
+            "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+            "s=-\r\n"
+            "t=0 0\r\n"
+            "a=group:BUNDLE 0 1\r\n"
+            "a=extmap-allow-mixed\r\n"
+            "a=msid-semantic: WMS stream\r\n"
+            "m=audio 9 UDP/TLS/RTP/SAVPF 111 63 9 0 8 13 110 126\r\n"
+            "c=IN IP4 0.0.0.0\r\n"
+            "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+            "a=ice-ufrag:Vd9X\r\n"
+            "a=ice-pwd:KkcSNWAQy4gQf2LzHqEwyOgF\r\n"
+            "a=ice-options:trickle\r\n"
+            "a=fingerprint:sha-256 5B:0D:8E:3C:A4:41:8F:28:9F:0A:39:BB:C6:11:7D:1B:63:74:8F:87:5A:AD:47:15:8C:8D:94:82:19:4E:76:0E\r\n"
+            "a=setup:actpass\r\n"
+            "a=mid:0\r\n"
+            "a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+            "a=extmap:2 http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time\r\n"
+            "a=extmap:3 http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01\r\n"
+            "a=sendrecv\r\n"
+            "a=msid:stream audio\r\n"
+            "a=rtcp-mux\r\n"
+            "a=rtpmap:111 opus/48000/2\r\n"
+            "a=rtcp-fb:111 transport-cc\r\n"
+            "a=fmtp:111 minptime=10;useinbandfec=1\r\n"
+            "a=ssrc:2938742611 cname:zE8hN0tWkOZPNmWz\r\n"
+            "a=ssrc:2938742611 msid:stream audio\r\n"
+            "m=video 9 UDP/TLS/RTP/SAVPF 96 97 98 99\r\n"
+            "c=IN IP4 0.0.0.0\r\n"
+            "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+            "a=ice-ufrag:Vd9X\r\n"
+            "a=ice-pwd:KkcSNWAQy4gQf2LzHqEwyOgF\r\n"
+            "a=ice-options:trickle\r\n"
+            "a=fingerprint:sha-256 5B:0D:8E:3C:A4:41:8F:28:9F:0A:39:BB:C6:11:7D:1B:63:74:8F:87:5A:AD:47:15:8C:8D:94:82:19:4E:76:0E\r\n"
+            "a=setup:actpass\r\n"
+            "a=mid:1\r\n"
+            "a=sendrecv\r\n"
+            "a=msid:stream video\r\n"
+            "a=rtcp-mux\r\n"
+            "a=rtcp-rsize\r\n"
+            "a=rtpmap:96 VP8/90000\r\n"
+            "a=rtcp-fb:96 goog-remb\r\n"
+            "a=rtcp-fb:96 transport-cc\r\n"
+            "a=rtcp-fb:96 nack\r\n"
+            "a=rtcp-fb:96 nack pli\r\n"
+            "a=rtpmap:97 rtx/90000\r\n"
+            "a=fmtp:97 apt=96\r\n"
+            "a=ssrc-group:FID 1394082641 3721938431\r\n"
+            "a=ssrc:1394082641 cname:zE8hN0tWkOZPNmWz\r\n"
+            "a=ssrc:1394082641 msid:stream video\r\n"
+            "a=ssrc:3721938431 cname:zE8hN0tWkOZPNmWz\r\n"
+            "a=ssrc:3721938431 msid:stream video\r\n";
+    }
+} // bench
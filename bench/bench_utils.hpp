@@ -0,0 +1,22 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ntgcalls/signaling/crypto/auth_key.hpp"
+#include "wrtc/utils/binary.hpp"
+
+namespace bench {
+    bytes::binary randomBinary(size_t size);
+
+    std::string randomString(size_t size);
+
+    signaling::EncryptionKey encryptionKey(bool isOutgoing);
+
+    // A browser-like offer carrying the attributes SdpBuilder::parseSdp looks up
+    std::string offerSdp();
+} // bench
@@ -0,0 +1,186 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include <benchmark/benchmark.h>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <openssl/aes.h>
+
+#include "bench_utils.hpp"
+#include "ntgcalls/signaling/crypto/mod_exp_first.hpp"
+#include "wrtc/utils/bignum.hpp"
+#include "wrtc/utils/encryption.hpp"
+#include "wrtc/utils/g_zip.hpp"
+#include "wrtc/utils/random.hpp"
+
+namespace bench {
+    static void AesPrepareKeyIv(benchmark::State& state) {
+        const auto key = encryptionKey(true);
+        const auto msgKey = randomBinary(16);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(openssl::Aes::PrepareKeyIv(key.value->data(), msgKey.data(), 128));
+        }
+    }
+
+    static void AesProcessCtr(benchmark::State& state) {
+        const auto key = encryptionKey(true);
+        const auto msgKey = randomBinary(16);
+        const auto data = randomBinary(state.range(0));
+        bytes::binary output(data.size());
+        for (auto _ : state) {
+            auto keyIv = openssl::Aes::PrepareKeyIv(key.value->data(), msgKey.data(), 128);
+            openssl::Aes::ProcessCtr(bytes::memory_span(data.data(), data.size()), output.data(), keyIv);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    static std::array<uint8_t, openssl::kSha256Size> legacySha256(const uint8_t* first, const size_t firstSize, const uint8_t* second, const size_t secondSize) {
+        auto result = std::array<uint8_t, openssl::kSha256Size>();
+        auto context = SHA256_CTX();
+        SHA256_Init(&context);
+        SHA256_Update(&context, first, firstSize);
+        SHA256_Update(&context, second, secondSize);
+        SHA256_Final(result.data(), &context);
+        return result;
+    }
+
+    // What a signaling packet used to cost: fresh SHA256_CTXs and an AES key schedule for every message
+    static void SignalingPacketLegacy(benchmark::State& state) {
+        const auto key = encryptionKey(true).value->data();
+        const auto data = randomBinary(state.range(0));
+        bytes::binary output(16 + data.size());
+        for (auto _ : state) {
+            const auto msgKeyLarge = legacySha256(key + 88 + 128, 32, data.data(), data.size());
+            const auto msgKey = output.data();
+            memcpy(msgKey, msgKeyLarge.data() + 8, 16);
+            const auto sha256a = legacySha256(msgKey, 16, key + 128, 36);
+            const auto sha256b = legacySha256(key + 40 + 128, 36, msgKey, 16);
+            uint8_t aesKey[32], aesIv[16];
+            memcpy(aesKey, sha256a.data(), 8);
+            memcpy(aesKey + 8, sha256b.data() + 8, 16);
+            memcpy(aesKey + 8 + 16, sha256a.data() + 24, 8);
+            memcpy(aesIv, sha256b.data(), 4);
+            memcpy(aesIv + 4, sha256a.data() + 8, 8);
+            memcpy(aesIv + 4 + 8, sha256b.data() + 24, 4);
+            auto aes = AES_KEY();
+            AES_set_encrypt_key(aesKey, sizeof(aesKey) * CHAR_BIT, &aes);
+            uint8_t ecountBuf[16] = {};
+            uint32_t offsetInBlock = 0;
+            AES_ctr128_encrypt(data.data(), output.data() + 16, data.size(), &aes, aesIv, ecountBuf, &offsetInBlock);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    static void SignalingPacketEvp(benchmark::State& state) {
+        const auto key = encryptionKey(true).value->data();
+        const auto data = randomBinary(state.range(0));
+        bytes::binary output(16 + data.size());
+        const openssl::Sha256::Context digest;
+        const openssl::Aes::Context cipher;
+        for (auto _ : state) {
+            const auto msgKeyLarge = digest.concat(
+                bytes::memory_span(key + 88 + 128, 32),
+                bytes::memory_span(data.data(), data.size())
+            );
+            const auto msgKey = output.data();
+            memcpy(msgKey, msgKeyLarge.data() + 8, 16);
+            const auto keyIv = openssl::Aes::PrepareKeyIv(digest, key, msgKey, 128);
+            cipher.processCtr(bytes::memory_span(data.data(), data.size()), output.data() + 16, keyIv);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // Signaling payloads are JSON, so compress text rather than noise
+    static bytes::binary jsonPayload(const size_t size) {
+        std::string json = "{\"@type\":\"Candidates\",\"candidates\":[";
+        while (json.size() < size) {
+            json += "{\"sdpString\":\"candidate:" + randomString(10) + " 1 udp 2122260223 192.168.1.10 51234 typ host generation 0\"},";
+        }
+        json.back() = ']';
+        json += "}";
+        return {json.begin(), json.end()};
+    }
+
+    static void GZipZip(benchmark::State& state) {
+        const auto data = jsonPayload(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bytes::GZip::zip(data));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+    }
+
+    static void GZipUnzip(benchmark::State& state) {
+        const auto data = jsonPayload(state.range(0));
+        const auto zipped = bytes::GZip::zip(data);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bytes::GZip::unzip(zipped, 2 * 1024 * 1024));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+    }
+
+    // The 2048-bit safe prime Telegram hands out in messages.getDhConfig
+    static bytes::vector telegramPrime() {
+        constexpr std::string_view hex =
+            "C71CAEB9C6B1C9048E6C522F70F13F73980D40238E3E21C14934D037563D930F"
+            "48198A0AA7C14058229493D22530F4DBFA336F6E0AC925139543AED44CCE7C37"
+            "20FD51F69458705AC68CD4FE6B6B13ABDC9746512969328454F18FAF8C595F64"
+            "2477FE96BB2A941D5BCD1D4AC8CC49880708FA9B378E3C4F3A9060BEE67CF9A4"
+            "A4A695811051907E162753B56B0F6B410DBA74D8A84B2A14B3144E0EF1284754"
+            "FD17ED950D5965B4B9DD46582DB1178D169C6BC465B0D6FF9CA3928FEF5B9AE4"
+            "E418FC15E83EBEA0F87FA9FF5EED70050DED2849F47BF959D956850CE929851F"
+            "0D8115F635B105EE2E4E15D04B2454BF6F4FADF034B10403119CD8E3B92FCC5B";
+        bytes::vector result(hex.size() / 2);
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = static_cast<bytes::byte>(std::stoi(std::string(hex.substr(i * 2, 2)), nullptr, 16));
+        }
+        return result;
+    }
+
+    // What every P2P call used to pay: prime, BN_CTX and Montgomery setup rebuilt per exponentiation
+    static void DhModExpFresh(benchmark::State& state) {
+        const auto prime = telegramPrime();
+        auto power = bytes::vector(256);
+        bytes::set_random(power);
+        for (auto _ : state) {
+            const auto result = openssl::BigNum();
+            result.setModExp(openssl::BigNum(3), openssl::BigNum(power), openssl::BigNum(prime), openssl::Context());
+            benchmark::DoNotOptimize(result.getBytes());
+        }
+    }
+
+    static void DhModExpCached(benchmark::State& state) {
+        const auto prime = telegramPrime();
+        auto power = bytes::vector(256);
+        bytes::set_random(power);
+        openssl::MontgomeryContext::Cached(prime);
+        for (auto _ : state) {
+            const auto result = openssl::BigNum();
+            result.setModExp(openssl::BigNum(3), openssl::BigNum(power), *openssl::MontgomeryContext::Cached(prime));
+            benchmark::DoNotOptimize(result.getBytes());
+        }
+    }
+
+    static void DhModExpFirst(benchmark::State& state) {
+        const auto prime = telegramPrime();
+        auto random = bytes::vector(256);
+        bytes::set_random(random);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(signaling::ModExpFirst(3, prime, random).modexp);
+        }
+    }
+
+    BENCHMARK(AesPrepareKeyIv);
+    BENCHMARK(AesProcessCtr)->Arg(64)->Arg(1024)->Arg(16 * 1024);
+    BENCHMARK(SignalingPacketLegacy)->Arg(64)->Arg(256)->Arg(1024)->Arg(4096)->Arg(16 * 1024);
+    BENCHMARK(SignalingPacketEvp)->Arg(64)->Arg(256)->Arg(1024)->Arg(4096)->Arg(16 * 1024);
+    BENCHMARK(GZipZip)->Arg(512)->Arg(4096)->Arg(64 * 1024);
+    BENCHMARK(GZipUnzip)->Arg(512)->Arg(4096)->Arg(64 * 1024);
+    BENCHMARK(DhModExpFresh);
+    BENCHMARK(DhModExpCached);
+    BENCHMARK(DhModExpFirst);
+} // bench
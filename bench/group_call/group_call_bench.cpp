@@ -0,0 +1,137 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <map>
+#include <set>
+#include <thread>
+#include <rtc_base/logging.h>
+
+#include "local_sfu.hpp"
+#include "../async_utils.hpp"
+#include "../p2p_load/synthetic_media.hpp"
+#include "ntgcalls/ntgcalls.hpp"
+
+namespace bench {
+    class Conference {
+        ntgcalls::MediaDescription media;
+        std::map<int64_t, std::string> payloads;
+        std::set<int64_t> connected;
+        int64_t nextId = 1;
+        std::mutex mutex;
+        std::condition_variable connectionChanged;
+
+    public:
+        LocalSfu sfu;
+        ntgcalls::NTgCalls client;
+
+        explicit Conference(const bool withVideo): media(syntheticMedia(std::filesystem::temp_directory_path() / "ntgcalls_group_bench", withVideo)) {
+            // NTgCalls raises the log level when its sink is created
+            rtc::LogMessage::LogToDebug(rtc::LS_NONE);
+            client.onConnectionChange([this](const int64_t chatId, const ntgcalls::CallInterface::ConnectionState state) {
+                std::lock_guard lock(mutex);
+                if (state == ntgcalls::CallInterface::ConnectionState::Connected) {
+                    connected.insert(chatId);
+                } else {
+                    connected.erase(chatId);
+                }
+                connectionChanged.notify_all();
+            });
+        }
+
+        ~Conference() {
+            leave();
+        }
+
+        void join(const size_t count) {
+            std::vector<int64_t> chatIds;
+            for (size_t i = 0; i < count; i++) {
+                const auto chatId = nextId++;
+                const auto payload = await(client.createCall(chatId, media));
+                await(client.connect(chatId, sfu.join(payload)));
+                payloads[chatId] = payload;
+                chatIds.push_back(chatId);
+            }
+            std::unique_lock lock(mutex);
+            const auto joined = connectionChanged.wait_for(lock, std::chrono::seconds(10), [&] {
+                return std::ranges::all_of(chatIds, [this](const int64_t chatId) {
+                    return connected.contains(chatId);
+                });
+            });
+            if (!joined) {
+                throw std::runtime_error("Timed out waiting for group calls to connect");
+            }
+        }
+
+        void leave() {
+            for (const auto& [chatId, payload] : payloads) {
+                try {
+                    await(client.stop(chatId));
+                } catch (const std::exception&) {}
+                sfu.leave(payload);
+            }
+            payloads.clear();
+        }
+    };
+
+    static void GroupCallJoin(benchmark::State& state) {
+        Conference conference(false);
+        const auto calls = static_cast<size_t>(state.range(0));
+        for (auto _ : state) {
+            try {
+                conference.join(calls);
+            } catch (const std::exception& e) {
+                state.SkipWithError(e.what());
+                break;
+            }
+            state.PauseTiming();
+            conference.leave();
+            state.ResumeTiming();
+        }
+        state.counters["joins"] = benchmark::Counter(static_cast<double>(state.iterations() * calls), benchmark::Counter::kIsRate);
+    }
+
+    static void GroupCallTeardown(benchmark::State& state) {
+        Conference conference(false);
+        const auto calls = static_cast<size_t>(state.range(0));
+        for (auto _ : state) {
+            state.PauseTiming();
+            try {
+                conference.join(calls);
+            } catch (const std::exception& e) {
+                state.SkipWithError(e.what());
+                break;
+            }
+            state.ResumeTiming();
+            conference.leave();
+        }
+        state.counters["leaves"] = benchmark::Counter(static_cast<double>(state.iterations() * calls), benchmark::Counter::kIsRate);
+    }
+
+    static void GroupCallThroughput(benchmark::State& state) {
+        Conference conference(state.range(1));
+        const auto calls = static_cast<size_t>(state.range(0));
+        try {
+            conference.join(calls);
+        } catch (const std::exception& e) {
+            state.SkipWithError(e.what());
+            return;
+        }
+        const auto before = conference.sfu.counters();
+        for (auto _ : state) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        const auto after = conference.sfu.counters();
+        state.counters["connected"] = static_cast<double>(after.connected);
+        state.counters["rtp_packets"] = benchmark::Counter(static_cast<double>(after.rtpPackets - before.rtpPackets), benchmark::Counter::kIsRate);
+        state.counters["rtp_bytes"] = benchmark::Counter(static_cast<double>(after.rtpBytes - before.rtpBytes), benchmark::Counter::kIsRate, benchmark::Counter::kIs1024);
+        state.counters["rtcp_packets"] = benchmark::Counter(static_cast<double>(after.rtcpPackets - before.rtcpPackets), benchmark::Counter::kIsRate);
+    }
+
+    BENCHMARK(GroupCallJoin)->Arg(1)->Arg(16)->Arg(64)->Iterations(3)->UseRealTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK(GroupCallTeardown)->Arg(1)->Arg(16)->Arg(64)->Iterations(3)->UseRealTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK(GroupCallThroughput)->Args({16, 0})->Args({64, 0})->Args({16, 1})->Iterations(10)->UseRealTime()->Unit(benchmark::kMillisecond);
+} // bench
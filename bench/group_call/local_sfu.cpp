@@ -0,0 +1,216 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include "local_sfu.hpp"
+
+#include <future>
+#include <ranges>
+#include <call/rtp_demuxer.h>
+#include <call/rtp_packet_sink_interface.h>
+#include <modules/rtp_rtcp/source/rtp_packet_received.h>
+#include <p2p/base/p2p_constants.h>
+#include <p2p/base/p2p_transport_channel.h>
+#include <p2p/client/basic_port_allocator.h>
+#include <pc/dtls_srtp_transport.h>
+#include <pc/dtls_transport.h>
+#include <rtc_base/crypto_random.h>
+#include <rtc_base/rtc_certificate_generator.h>
+#include <nlohmann/json.hpp>
+
+#include "wrtc/interfaces/native_connection.hpp"
+
+namespace bench {
+    using nlohmann::json;
+
+    class LocalSfu::Endpoint final : public sigslot::has_slots<>, public webrtc::RtpPacketSinkInterface {
+        LocalSfu* sfu;
+        std::string localUfrag, localPwd;
+        std::unique_ptr<cricket::BasicPortAllocator> portAllocator;
+        std::unique_ptr<cricket::P2PTransportChannel> transportChannel;
+        std::unique_ptr<cricket::DtlsTransport> dtlsTransport;
+        std::unique_ptr<webrtc::DtlsSrtpTransport> dtlsSrtpTransport;
+        std::vector<cricket::Candidate> candidates;
+        std::promise<void> gatheringPromise;
+        bool gatheringDone = false;
+
+        void candidateGathered(cricket::IceTransportInternal*, const cricket::Candidate& candidate) {
+            candidates.push_back(candidate);
+        }
+
+        void gatheringStateChanged(cricket::IceTransportInternal* transport) {
+            if (transport->gathering_state() == cricket::kIceGatheringComplete && !gatheringDone) {
+                gatheringDone = true;
+                gatheringPromise.set_value();
+            }
+        }
+
+    public:
+        Endpoint(LocalSfu* sfu, const cricket::IceParameters& remoteIceParameters, const rtc::SSLFingerprint& remoteFingerprint, const std::vector<uint32_t>& ssrcs): sfu(sfu) {
+            localUfrag = rtc::CreateRandomString(cricket::ICE_UFRAG_LENGTH);
+            localPwd = rtc::CreateRandomString(cricket::ICE_PWD_LENGTH);
+
+            portAllocator = std::make_unique<cricket::BasicPortAllocator>(sfu->networkManager.get(), sfu->socketFactory.get());
+            portAllocator->set_flags(portAllocator->flags() | cricket::PORTALLOCATOR_DISABLE_TCP | cricket::PORTALLOCATOR_DISABLE_STUN | cricket::PORTALLOCATOR_DISABLE_RELAY);
+            portAllocator->set_step_delay(cricket::kMinimumStepDelay);
+            portAllocator->Initialize();
+            portAllocator->SetConfiguration({}, {}, 0, webrtc::NO_PRUNE);
+
+            webrtc::IceTransportInit iceTransportInit;
+            iceTransportInit.set_port_allocator(portAllocator.get());
+            transportChannel = cricket::P2PTransportChannel::Create("sfu", cricket::ICE_CANDIDATE_COMPONENT_RTP, std::move(iceTransportInit));
+            transportChannel->SetIceParameters(cricket::IceParameters(localUfrag, localPwd, false));
+            transportChannel->SetRemoteIceParameters(remoteIceParameters);
+            // The client is the controlling agent, as the answer advertises ice-lite
+            transportChannel->SetIceRole(cricket::ICEROLE_CONTROLLED);
+            transportChannel->SetRemoteIceMode(cricket::ICEMODE_FULL);
+            transportChannel->SignalCandidateGathered.connect(this, &Endpoint::candidateGathered);
+            transportChannel->SignalGatheringState.connect(this, &Endpoint::gatheringStateChanged);
+
+            dtlsTransport = std::make_unique<cricket::DtlsTransport>(transportChannel.get(), wrtc::NativeConnection::getDefaultCryptoOptions(), nullptr);
+            dtlsTransport->SetLocalCertificate(sfu->certificate);
+            // CallPayload always offers setup:active, so this side is the DTLS server
+            dtlsTransport->SetRemoteParameters(remoteFingerprint.algorithm, remoteFingerprint.digest.data(), remoteFingerprint.digest.size(), rtc::SSL_SERVER);
+
+            dtlsSrtpTransport = std::make_unique<webrtc::DtlsSrtpTransport>(true, sfu->fieldTrials);
+            dtlsSrtpTransport->SetDtlsTransports(dtlsTransport.get(), nullptr);
+            dtlsSrtpTransport->SubscribeRtcpPacketReceived(this, [this](const rtc::CopyOnWriteBuffer*, int64_t) {
+                ++this->sfu->rtcpPackets;
+            });
+            webrtc::RtpDemuxerCriteria criteria;
+            for (const auto ssrc : ssrcs) {
+                criteria.ssrcs().insert(ssrc);
+            }
+            dtlsSrtpTransport->RegisterRtpDemuxerSink(criteria, this);
+
+            transportChannel->MaybeStartGathering();
+        }
+
+        std::future<void> gathered() {
+            return gatheringPromise.get_future();
+        }
+
+        bool connected() const {
+            return dtlsTransport->writable();
+        }
+
+        json transport() const {
+            auto candidatesJson = json::array();
+            for (const auto& candidate : candidates) {
+                candidatesJson.push_back({
+                    {"generation", std::to_string(candidate.generation())},
+                    {"component", std::to_string(candidate.component())},
+                    {"protocol", candidate.protocol()},
+                    {"port", std::to_string(candidate.address().port())},
+                    {"ip", candidate.address().ipaddr().ToString()},
+                    {"foundation", candidate.foundation()},
+                    {"id", candidate.id()},
+                    {"priority", std::to_string(candidate.priority())},
+                    {"type", std::string(candidate.type_name())},
+                    {"network", std::to_string(candidate.network_id())},
+                });
+            }
+            return {
+                {"ufrag", localUfrag},
+                {"pwd", localPwd},
+                {"fingerprints", {
+                    {
+                        {"hash", sfu->fingerprint->algorithm},
+                        {"setup", "passive"},
+                        {"fingerprint", sfu->fingerprint->GetRfc4572Fingerprint()}
+                    }
+                }},
+                {"candidates", candidatesJson},
+            };
+        }
+
+        void OnRtpPacket(const webrtc::RtpPacketReceived& packet) override {
+            ++sfu->rtpPackets;
+            sfu->rtpBytes += packet.size();
+        }
+    };
+
+    LocalSfu::LocalSfu() {
+        networkThread = rtc::Thread::CreateWithSocketServer();
+        networkThread->SetName("LocalSfu", nullptr);
+        networkThread->Start();
+        certificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
+        fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*certificate);
+        networkThread->BlockingCall([this] {
+            socketFactory = std::make_unique<rtc::BasicPacketSocketFactory>(networkThread->socketserver());
+            networkManager = std::make_unique<rtc::BasicNetworkManager>(nullptr, networkThread->socketserver(), &fieldTrials);
+        });
+    }
+
+    LocalSfu::~LocalSfu() {
+        networkThread->BlockingCall([this] {
+            endpoints.clear();
+            networkManager = nullptr;
+            socketFactory = nullptr;
+        });
+        networkThread->Stop();
+    }
+
+    std::string LocalSfu::join(const std::string& payload) {
+        const auto data = json::parse(payload);
+        const auto ufrag = data["ufrag"].get<std::string>();
+        const cricket::IceParameters remoteIceParameters(ufrag, data["pwd"].get<std::string>(), false);
+        const auto& rawFingerprint = data["fingerprints"][0];
+        const auto remoteFingerprint = rtc::SSLFingerprint::CreateUniqueFromRfc4572(
+            rawFingerprint["hash"].get<std::string>(),
+            rawFingerprint["fingerprint"].get<std::string>()
+        );
+        if (!remoteFingerprint) {
+            throw std::invalid_argument("Invalid fingerprint");
+        }
+        std::vector ssrcs = {static_cast<uint32_t>(data["ssrc"].get<wrtc::TgSSRC>())};
+        if (data.contains("ssrc-groups")) {
+            for (const auto& group : data["ssrc-groups"]) {
+                for (const auto& ssrc : group["sources"]) {
+                    ssrcs.push_back(static_cast<uint32_t>(ssrc.get<wrtc::TgSSRC>()));
+                }
+            }
+        }
+        std::future<void> gathered;
+        networkThread->BlockingCall([&] {
+            auto endpoint = std::make_unique<Endpoint>(this, remoteIceParameters, *remoteFingerprint, ssrcs);
+            gathered = endpoint->gathered();
+            endpoints[ufrag] = std::move(endpoint);
+        });
+        gathered.wait();
+        json transport;
+        networkThread->BlockingCall([&] {
+            transport = endpoints[ufrag]->transport();
+        });
+        return to_string(json{{"transport", transport}});
+    }
+
+    void LocalSfu::leave(const std::string& payload) {
+        const auto ufrag = json::parse(payload)["ufrag"].get<std::string>();
+        networkThread->BlockingCall([&] {
+            endpoints.erase(ufrag);
+        });
+    }
+
+    void LocalSfu::clear() {
+        networkThread->BlockingCall([this] {
+            endpoints.clear();
+        });
+    }
+
+    LocalSfu::Counters LocalSfu::counters() {
+        Counters result;
+        result.rtpPackets = rtpPackets;
+        result.rtpBytes = rtpBytes;
+        result.rtcpPackets = rtcpPackets;
+        networkThread->BlockingCall([&] {
+            result.endpoints = endpoints.size();
+            for (const auto& endpoint : endpoints | std::views::values) {
+                if (endpoint->connected()) {
+                    result.connected++;
+                }
+            }
+        });
+        return result;
+    }
+} // bench
@@ -0,0 +1,56 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <api/transport/field_trial_based_config.h>
+#include <p2p/base/basic_packet_socket_factory.h>
+#include <rtc_base/network.h>
+#include <rtc_base/rtc_certificate.h>
+#include <rtc_base/ssl_fingerprint.h>
+#include <rtc_base/thread.h>
+
+namespace bench {
+    // Ice-lite, DTLS-SRTP answerer standing in for Telegram's group call server.
+    // It accepts the join payload produced by GroupCall::init, answers with a
+    // compatible transport JSON and sinks the RTP it receives, counting it.
+    class LocalSfu {
+        class Endpoint;
+
+        std::unique_ptr<rtc::Thread> networkThread;
+        std::unique_ptr<rtc::BasicNetworkManager> networkManager;
+        std::unique_ptr<rtc::BasicPacketSocketFactory> socketFactory;
+        webrtc::FieldTrialBasedConfig fieldTrials;
+        rtc::scoped_refptr<rtc::RTCCertificate> certificate;
+        std::unique_ptr<rtc::SSLFingerprint> fingerprint;
+        std::map<std::string, std::unique_ptr<Endpoint>> endpoints;
+        std::atomic_uint64_t rtpPackets = 0, rtpBytes = 0, rtcpPackets = 0;
+
+    public:
+        struct Counters {
+            uint64_t rtpPackets = 0;
+            uint64_t rtpBytes = 0;
+            uint64_t rtcpPackets = 0;
+            size_t endpoints = 0;
+            size_t connected = 0;
+        };
+
+        LocalSfu();
+
+        ~LocalSfu();
+
+        // Returns the join response, once the endpoint has gathered its candidates
+        std::string join(const std::string& payload);
+
+        void leave(const std::string& payload);
+
+        void clear();
+
+        Counters counters();
+    };
+} // bench
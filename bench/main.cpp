@@ -0,0 +1,18 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include <benchmark/benchmark.h>
+#include <rtc_base/logging.h>
+
+int main(int argc, char** argv) {
+    // Failed decryptions and signaling traces would otherwise dominate the timings
+    rtc::LogMessage::LogToDebug(rtc::LS_NONE);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
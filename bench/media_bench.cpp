@@ -0,0 +1,23 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "wrtc/models/i420_image_data.hpp"
+
+namespace bench {
+    static void I420Buffer(benchmark::State& state) {
+        const auto width = static_cast<uint16_t>(state.range(0));
+        const auto height = static_cast<uint16_t>(state.range(1));
+        auto frame = randomBinary(width * height * 3 / 2);
+        const wrtc::i420ImageData image(width, height, frame.data());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(image.buffer());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * frame.size()));
+    }
+
+    BENCHMARK(I420Buffer)->Args({640, 360})->Args({1280, 720})->Args({1920, 1080});
+} // bench
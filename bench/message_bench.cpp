@@ -0,0 +1,231 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "ntgcalls/signaling/compression_dictionary.hpp"
+#include "ntgcalls/signaling/messages/candidate_message.hpp"
+#include "ntgcalls/signaling/messages/candidates_message.hpp"
+#include "ntgcalls/signaling/messages/decoded_message.hpp"
+#include "ntgcalls/signaling/messages/initial_setup_message.hpp"
+#include "ntgcalls/signaling/messages/media_state_message.hpp"
+#include "ntgcalls/signaling/messages/negotiate_channels_message.hpp"
+#include "ntgcalls/signaling/messages/rtc_description_message.hpp"
+#include "wrtc/utils/g_zip.hpp"
+
+namespace bench {
+    static std::string candidateSdp() {
+        return "candidate:" + randomString(10) + " 1 udp 2122260223 192.168.1.10 51234 typ host generation 0 ufrag Vd9X network-id 1";
+    }
+
+    static signaling::CandidateMessage candidateMessage() {
+        signaling::CandidateMessage message;
+        message.mid = "0";
+        message.mLine = 0;
+        message.sdp = candidateSdp();
+        return message;
+    }
+
+    static signaling::CandidatesMessage candidatesMessage() {
+        signaling::CandidatesMessage message;
+        for (int i = 0; i < 8; i++) {
+            message.iceCandidates.push_back({candidateSdp()});
+        }
+        return message;
+    }
+
+    static signaling::InitialSetupMessage initialSetupMessage() {
+        signaling::InitialSetupMessage message;
+        message.ufrag = randomString(4);
+        message.pwd = randomString(24);
+        message.supportsRenomination = true;
+        message.fingerprints.push_back({
+            "sha-256",
+            "actpass",
+            "5B:0D:8E:3C:A4:41:8F:28:9F:0A:39:BB:C6:11:7D:1B:63:74:8F:87:5A:AD:47:15:8C:8D:94:82:19:4E:76:0E",
+        });
+        return message;
+    }
+
+    static signaling::RtcDescriptionMessage rtcDescriptionMessage() {
+        signaling::RtcDescriptionMessage message;
+        message.type = wrtc::Description::SdpType::Offer;
+        message.sdp = offerSdp();
+        return message;
+    }
+
+    static signaling::NegotiateChannelsMessage negotiateChannelsMessage() {
+        signaling::NegotiateChannelsMessage message;
+        message.exchangeId = 1;
+
+        wrtc::MediaContent audio;
+        audio.type = wrtc::MediaContent::Type::Audio;
+        audio.ssrc = 2938742611;
+        wrtc::PayloadType opus;
+        opus.id = 111;
+        opus.name = "opus";
+        opus.clockrate = 48000;
+        opus.channels = 2;
+        opus.feedbackTypes.push_back({"transport-cc", ""});
+        opus.parameters.emplace_back("minptime", "10");
+        opus.parameters.emplace_back("useinbandfec", "1");
+        audio.payloadTypes.push_back(opus);
+        audio.rtpExtensions.emplace_back("urn:ietf:params:rtp-hdrext:ssrc-audio-level", 1);
+        audio.rtpExtensions.emplace_back("http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time", 2);
+        audio.rtpExtensions.emplace_back("http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01", 3);
+        message.contents.push_back(audio);
+
+        wrtc::MediaContent video;
+        video.type = wrtc::MediaContent::Type::Video;
+        video.ssrc = 1394082641;
+        video.ssrcGroups.push_back({{1394082641, 3721938431}, "FID"});
+        for (const auto& [id, name] : std::vector<std::pair<uint32_t, std::string>>{{96, "VP8"}, {98, "VP9"}, {100, "H264"}}) {
+            wrtc::PayloadType payloadType;
+            payloadType.id = id;
+            payloadType.name = name;
+            payloadType.clockrate = 90000;
+            payloadType.feedbackTypes = {{"goog-remb", ""}, {"transport-cc", ""}, {"ccm", "fir"}, {"nack", ""}, {"nack", "pli"}};
+            video.payloadTypes.push_back(payloadType);
+            wrtc::PayloadType rtx;
+            rtx.id = id + 1;
+            rtx.name = "rtx";
+            rtx.clockrate = 90000;
+            rtx.parameters.emplace_back("apt", std::to_string(id));
+            video.payloadTypes.push_back(rtx);
+        }
+        video.rtpExtensions = audio.rtpExtensions;
+        message.contents.push_back(video);
+        return message;
+    }
+
+    static void MessageType(benchmark::State& state) {
+        const std::vector payloads = {
+            candidateMessage().serialize(),
+            candidatesMessage().serialize(),
+            initialSetupMessage().serialize(),
+            rtcDescriptionMessage().serialize(),
+            negotiateChannelsMessage().serialize(),
+        };
+        size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(signaling::Message::type(payloads[i++ % payloads.size()]));
+        }
+    }
+
+    template <typename MessageType>
+    static void MessageSerialize(benchmark::State& state, const MessageType& message) {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(message.serialize());
+        }
+    }
+
+    template <typename MessageType>
+    static void MessageDeserialize(benchmark::State& state, const MessageType& message) {
+        const auto payload = message.serialize();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(MessageType::deserialize(payload));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    template <typename MessageType>
+    static void MessageTwoPass(benchmark::State& state, const MessageType& message) {
+        const auto payload = message.serialize();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(signaling::Message::type(payload));
+            benchmark::DoNotOptimize(MessageType::deserialize(payload));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    template <typename MessageType>
+    static void MessageDecode(benchmark::State& state, const MessageType& message) {
+        const auto payload = message.serialize();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(signaling::decode(payload));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    template <typename MessageType>
+    static void CompressFreshStream(benchmark::State& state, const MessageType& message) {
+        const auto payload = message.serialize();
+        size_t compressedSize = 0;
+        for (auto _ : state) {
+            bytes::GZip gzip(static_cast<int>(state.range(0)));
+            const auto compressed = gzip.compress(payload);
+            compressedSize = compressed.size();
+            benchmark::DoNotOptimize(compressed);
+        }
+        state.counters["bytes"] = static_cast<double>(compressedSize);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    template <typename MessageType>
+    static void CompressReusedStream(benchmark::State& state, const MessageType& message, const bool useDictionary) {
+        const auto payload = message.serialize();
+        const auto dictionary = useDictionary ? signaling::compressionDictionary() : std::string_view();
+        const auto level = static_cast<int>(state.range(0));
+        bytes::GZip local(level, dictionary), remote(level, dictionary);
+        local.decompress(remote.compress(payload), 0);
+        size_t compressedSize = 0;
+        for (auto _ : state) {
+            const auto compressed = local.compress(payload);
+            compressedSize = compressed.size();
+            benchmark::DoNotOptimize(compressed);
+        }
+        state.counters["bytes"] = static_cast<double>(compressedSize);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    template <typename MessageType>
+    static void DecompressReusedStream(benchmark::State& state, const MessageType& message, const bool useDictionary) {
+        const auto payload = message.serialize();
+        const auto dictionary = useDictionary ? signaling::compressionDictionary() : std::string_view();
+        bytes::GZip local(bytes::GZip::DefaultLevel, dictionary), remote(bytes::GZip::DefaultLevel, dictionary);
+        local.decompress(remote.compress(payload), 0);
+        const auto compressed = remote.compress(payload);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(local.decompress(compressed, 0));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    BENCHMARK(MessageType);
+    BENCHMARK_CAPTURE(MessageSerialize, Candidate, candidateMessage());
+    BENCHMARK_CAPTURE(MessageSerialize, Candidates, candidatesMessage());
+    BENCHMARK_CAPTURE(MessageSerialize, InitialSetup, initialSetupMessage());
+    BENCHMARK_CAPTURE(MessageSerialize, RtcDescription, rtcDescriptionMessage());
+    BENCHMARK_CAPTURE(MessageSerialize, NegotiateChannels, negotiateChannelsMessage());
+    BENCHMARK_CAPTURE(MessageSerialize, MediaState, signaling::MediaStateMessage());
+    BENCHMARK_CAPTURE(MessageDeserialize, Candidate, candidateMessage());
+    BENCHMARK_CAPTURE(MessageDeserialize, Candidates, candidatesMessage());
+    BENCHMARK_CAPTURE(MessageDeserialize, InitialSetup, initialSetupMessage());
+    BENCHMARK_CAPTURE(MessageDeserialize, RtcDescription, rtcDescriptionMessage());
+    BENCHMARK_CAPTURE(MessageDeserialize, NegotiateChannels, negotiateChannelsMessage());
+    BENCHMARK_CAPTURE(MessageTwoPass, Candidate, candidateMessage());
+    BENCHMARK_CAPTURE(MessageTwoPass, Candidates, candidatesMessage());
+    BENCHMARK_CAPTURE(MessageTwoPass, NegotiateChannels, negotiateChannelsMessage());
+    BENCHMARK_CAPTURE(MessageDecode, Candidate, candidateMessage());
+    BENCHMARK_CAPTURE(MessageDecode, Candidates, candidatesMessage());
+    BENCHMARK_CAPTURE(MessageDecode, NegotiateChannels, negotiateChannelsMessage());
+    BENCHMARK_CAPTURE(CompressFreshStream, Candidate, candidateMessage())->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressFreshStream, InitialSetup, initialSetupMessage())->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressFreshStream, NegotiateChannels, negotiateChannelsMessage())->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressFreshStream, RtcDescription, rtcDescriptionMessage())->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressFreshStream, MediaState, signaling::MediaStateMessage())->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, Candidate, candidateMessage(), false)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, CandidateDictionary, candidateMessage(), true)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, InitialSetup, initialSetupMessage(), false)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, InitialSetupDictionary, initialSetupMessage(), true)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, NegotiateChannels, negotiateChannelsMessage(), false)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, NegotiateChannelsDictionary, negotiateChannelsMessage(), true)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, RtcDescription, rtcDescriptionMessage(), false)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, RtcDescriptionDictionary, rtcDescriptionMessage(), true)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, MediaState, signaling::MediaStateMessage(), false)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(CompressReusedStream, MediaStateDictionary, signaling::MediaStateMessage(), true)->Arg(6)->Arg(9);
+    BENCHMARK_CAPTURE(DecompressReusedStream, NegotiateChannels, negotiateChannelsMessage(), false);
+    BENCHMARK_CAPTURE(DecompressReusedStream, NegotiateChannelsDictionary, negotiateChannelsMessage(), true);
+} // bench
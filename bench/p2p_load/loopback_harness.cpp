@@ -0,0 +1,175 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include "loopback_harness.hpp"
+
+#include <iostream>
+#include <random>
+#include <ranges>
+
+#include "../async_utils.hpp"
+
+namespace bench {
+    // Telegram's 2048-bit safe prime, for which g = 3 is a valid generator
+    static constexpr char kPrime[] =
+        "c71caeb9c6b1c9048e6c522f70f13f73980d40238e3e21c14934d037563d930f"
+        "48198a0aa7c14058229493d22530f4dbfa336f6e0ac925139543aed44cce7c37"
+        "20fd51f69458705ac68cd4fe6b6b13abdc9746512969328454f18faf8c595f64"
+        "2477fe96bb2a941d5bcd1d4ac8cc49880708fa9b378e3c4f3a9060bee67cf9a4"
+        "a4a695811051907e162753b56b0f6b410dba74d8a84b2a14b3144e0ef1284754"
+        "fd17ed950d5965b4b9dd46582db1178d169c6bc465b0d6ff9ca3928fef5b9ae4"
+        "e418fc15e83ebea0f87fa9ff5eed70050ded2849f47bf959d956850ce929851f"
+        "0d8115f635b105ee2e4e15d04b2454bf6f4fadf034b10403119cd8e3b92fcc5b";
+
+    LoopbackHarness::LoopbackHarness(ntgcalls::MediaDescription media): media(std::move(media)) {
+        versions = ntgcalls::NTgCalls::getProtocol().library_versions;
+        caller.onSignalingData([this](const int64_t id, const bytes::binary& data) {
+            if (!closing) {
+                callee.sendSignalingData(id, rtc::CopyOnWriteBuffer(data.data(), data.size())).then([] {}, [](const std::exception_ptr&) {});
+            }
+        });
+        callee.onSignalingData([this](const int64_t id, const bytes::binary& data) {
+            if (!closing) {
+                caller.sendSignalingData(id, rtc::CopyOnWriteBuffer(data.data(), data.size())).then([] {}, [](const std::exception_ptr&) {});
+            }
+        });
+        caller.onConnectionChange([this](const int64_t id, const ntgcalls::CallInterface::ConnectionState state) {
+            updateState(id, state, true);
+        });
+        callee.onConnectionChange([this](const int64_t id, const ntgcalls::CallInterface::ConnectionState state) {
+            updateState(id, state, false);
+        });
+        // The clips are finite, start them over so the load stays constant
+        for (auto* instance : {&caller, &callee}) {
+            instance->onStreamEnd([this, instance](const int64_t id, ntgcalls::Stream::Type) {
+                if (!closing) {
+                    instance->changeStream(id, this->media).then([] {}, [](const std::exception_ptr&) {});
+                }
+            });
+        }
+    }
+
+    LoopbackHarness::~LoopbackHarness() {
+        closing = true;
+        std::vector<int64_t> ids;
+        {
+            std::lock_guard lock(mutex);
+            for (const auto& id : pairs | std::views::keys) {
+                ids.push_back(id);
+            }
+        }
+        for (const auto id : ids) {
+            removePair(id);
+        }
+    }
+
+    ntgcalls::DhConfig LoopbackHarness::dhConfig() {
+        static std::mt19937 generator(std::random_device{}());
+        std::uniform_int_distribution<int> distribution(0, 255);
+        bytes::vector prime(sizeof(kPrime) / 2);
+        for (size_t i = 0; i < prime.size(); i++) {
+            prime[i] = static_cast<uint8_t>(std::stoi(std::string(kPrime + i * 2, 2), nullptr, 16));
+        }
+        bytes::vector random(256);
+        for (auto& byte : random) {
+            byte = static_cast<uint8_t>(distribution(generator));
+        }
+        return {3, prime, random};
+    }
+
+    void LoopbackHarness::updateState(const int64_t id, const ntgcalls::CallInterface::ConnectionState state, const bool isCaller) {
+        std::lock_guard lock(mutex);
+        const auto it = pairs.find(id);
+        if (it == pairs.end()) {
+            return;
+        }
+        switch (state) {
+        case ntgcalls::CallInterface::ConnectionState::Connected:
+            (isCaller ? it->second.callerConnected : it->second.calleeConnected) = true;
+            break;
+        case ntgcalls::CallInterface::ConnectionState::Failed:
+        case ntgcalls::CallInterface::ConnectionState::Timeout:
+        case ntgcalls::CallInterface::ConnectionState::Closed:
+            it->second.failed = true;
+            break;
+        default:
+            break;
+        }
+        stateChanged.notify_all();
+    }
+
+    void LoopbackHarness::removePair(const int64_t id) {
+        for (auto* instance : {&caller, &callee}) {
+            try {
+                await(instance->stop(id));
+            } catch (const std::exception&) {}
+        }
+        std::lock_guard lock(mutex);
+        pairs.erase(id);
+    }
+
+    LoopbackHarness::Setup LoopbackHarness::addPair(const std::chrono::milliseconds timeout) {
+        int64_t id;
+        {
+            std::lock_guard lock(mutex);
+            id = nextId++;
+            pairs[id] = {};
+        }
+        const auto start = std::chrono::steady_clock::now();
+        const auto elapsed = [&start] {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        };
+        try {
+            const auto g_a_hash = await(caller.createP2PCall(id, dhConfig(), std::nullopt, media));
+            const auto g_b = await(callee.createP2PCall(id, dhConfig(), g_a_hash, media));
+            const auto callerAuth = await(caller.exchangeKeys(id, g_b, 0));
+            await(callee.exchangeKeys(id, callerAuth.g_a_or_b, callerAuth.key_fingerprint));
+            await(caller.connectP2P(id, {}, versions, true));
+            await(callee.connectP2P(id, {}, versions, true));
+        } catch (const std::exception& e) {
+            std::cerr << "Pair " << id << " setup failed: " << e.what() << std::endl;
+            removePair(id);
+            return {false, elapsed()};
+        }
+        std::unique_lock lock(mutex);
+        const auto ready = stateChanged.wait_for(lock, timeout, [this, id] {
+            const auto& state = pairs[id];
+            return state.failed || (state.callerConnected && state.calleeConnected);
+        });
+        if (ready && !pairs[id].failed) {
+            return {true, elapsed()};
+        }
+        lock.unlock();
+        removePair(id);
+        return {false, elapsed()};
+    }
+
+    std::vector<double> LoopbackHarness::pacingJitter() {
+        std::vector<int64_t> ids;
+        {
+            std::lock_guard lock(mutex);
+            for (const auto& [id, state] : pairs) {
+                if (state.callerConnected && state.calleeConnected && !state.failed) {
+                    ids.push_back(id);
+                }
+            }
+        }
+        std::vector<double> result;
+        result.reserve(ids.size());
+        for (const auto id : ids) {
+            try {
+                result.push_back(std::max(
+                    await(caller.stats(id)).pacingJitterMs,
+                    await(callee.stats(id)).pacingJitterMs
+                ));
+            } catch (const std::exception&) {}
+        }
+        return result;
+    }
+
+    size_t LoopbackHarness::size() {
+        std::lock_guard lock(mutex);
+        return pairs.size();
+    }
+} // bench
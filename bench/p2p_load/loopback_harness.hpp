@@ -0,0 +1,54 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+
+#include "ntgcalls/ntgcalls.hpp"
+
+namespace bench {
+    // Pairs of P2P calls living in one process, with each side's signaling fed straight into the other
+    class LoopbackHarness {
+        struct PairState {
+            bool callerConnected = false, calleeConnected = false, failed = false;
+        };
+
+        ntgcalls::MediaDescription media;
+        std::vector<std::string> versions;
+        std::map<int64_t, PairState> pairs;
+        std::atomic_bool closing = false;
+        int64_t nextId = 1;
+        std::mutex mutex;
+        std::condition_variable stateChanged;
+        // Declared last so their callbacks never outlive the state above
+        ntgcalls::NTgCalls caller, callee;
+
+        void updateState(int64_t id, ntgcalls::CallInterface::ConnectionState state, bool isCaller);
+
+        void removePair(int64_t id);
+
+        static ntgcalls::DhConfig dhConfig();
+
+    public:
+        struct Setup {
+            bool connected = false;
+            std::chrono::milliseconds elapsed{};
+        };
+
+        explicit LoopbackHarness(ntgcalls::MediaDescription media);
+
+        ~LoopbackHarness();
+
+        Setup addPair(std::chrono::milliseconds timeout);
+
+        // Worst pacing jitter of the two ends of every connected pair
+        std::vector<double> pacingJitter();
+
+        size_t size();
+    };
+} // bench
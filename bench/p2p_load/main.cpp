@@ -0,0 +1,154 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <rtc_base/logging.h>
+#include <string_view>
+#include <thread>
+
+#include "loopback_harness.hpp"
+#include "process_monitor.hpp"
+#include "synthetic_media.hpp"
+
+struct Options {
+    size_t start = 1, step = 1, max = 256;
+    std::chrono::seconds hold{10}, warmup{3};
+    std::chrono::milliseconds timeout{10000};
+    double maxJitterMs = 10, maxCpuUsage = 90;
+    bool video = false;
+};
+
+static Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        if (arg == "--video") {
+            options.video = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Missing value for " + std::string(arg));
+        }
+        const std::string value = argv[++i];
+        if (arg == "--start") {
+            options.start = std::stoul(value);
+        } else if (arg == "--step") {
+            options.step = std::stoul(value);
+        } else if (arg == "--max") {
+            options.max = std::stoul(value);
+        } else if (arg == "--hold") {
+            options.hold = std::chrono::seconds(std::stol(value));
+        } else if (arg == "--timeout") {
+            options.timeout = std::chrono::milliseconds(std::stol(value));
+        } else if (arg == "--max-jitter") {
+            options.maxJitterMs = std::stod(value);
+        } else if (arg == "--max-cpu") {
+            options.maxCpuUsage = std::stod(value);
+        } else {
+            throw std::invalid_argument("Unknown option " + std::string(arg));
+        }
+    }
+    options.start = std::max<size_t>(options.start, 1);
+    options.step = std::max<size_t>(options.step, 1);
+    return options;
+}
+
+static double percentile(std::vector<double> values, const double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::ranges::sort(values);
+    return values[std::min(values.size() - 1, static_cast<size_t>(p * static_cast<double>(values.size())))];
+}
+
+int main(const int argc, char** argv) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl
+            << "Usage: ntgcalls_p2p_load [--start N] [--step N] [--max N] [--hold SECONDS] [--timeout MS]"
+            " [--max-jitter MS] [--max-cpu PERCENT] [--video]" << std::endl;
+        return 1;
+    }
+
+    const auto media = bench::syntheticMedia(std::filesystem::temp_directory_path() / "ntgcalls_p2p_load", options.video);
+    bench::LoopbackHarness harness(media);
+    bench::ProcessMonitor monitor;
+    // NTgCalls raises the log level when its sink is created, quiet it again for readable output
+    rtc::LogMessage::LogToDebug(rtc::LS_NONE);
+
+    std::cout << std::left
+        << std::setw(7) << "calls"
+        << std::setw(10) << "failed"
+        << std::setw(13) << "setup p50"
+        << std::setw(13) << "setup max"
+        << std::setw(9) << "cpu %"
+        << std::setw(10) << "rss MB"
+        << std::setw(9) << "threads"
+        << std::setw(12) << "jitter p50"
+        << std::setw(12) << "jitter p95"
+        << std::setw(12) << "jitter max" << std::endl;
+
+    size_t sustained = 0;
+    std::string degradation;
+    for (auto target = options.start; target <= options.max && degradation.empty(); target += options.step) {
+        std::vector<double> setupTimes;
+        size_t failures = 0;
+        while (harness.size() < target && failures < target) {
+            if (const auto [connected, elapsed] = harness.addPair(options.timeout); connected) {
+                setupTimes.push_back(static_cast<double>(elapsed.count()));
+            } else {
+                failures++;
+            }
+        }
+        std::this_thread::sleep_for(options.warmup);
+
+        (void) monitor.sample();
+        std::vector<double> jitter;
+        const auto end = std::chrono::steady_clock::now() + options.hold;
+        while (std::chrono::steady_clock::now() < end) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            const auto sample = harness.pacingJitter();
+            jitter.resize(std::max(jitter.size(), sample.size()));
+            for (size_t i = 0; i < sample.size(); i++) {
+                jitter[i] = std::max(jitter[i], sample[i]);
+            }
+        }
+        const auto process = monitor.sample();
+        const auto healthy = harness.pacingJitter().size();
+        failures += harness.size() - healthy;
+
+        std::cout << std::left << std::fixed << std::setprecision(1)
+            << std::setw(7) << healthy
+            << std::setw(10) << failures
+            << std::setw(13) << percentile(setupTimes, 0.5)
+            << std::setw(13) << percentile(setupTimes, 1)
+            << std::setw(9) << process.cpuUsage
+            << std::setw(10) << static_cast<double>(process.residentKb) / 1024
+            << std::setw(9) << process.threads
+            << std::setw(12) << percentile(jitter, 0.5)
+            << std::setw(12) << percentile(jitter, 0.95)
+            << std::setw(12) << percentile(jitter, 1) << std::endl;
+
+        if (failures > 0) {
+            degradation = std::to_string(failures) + " call(s) failed to connect or dropped";
+        } else if (percentile(jitter, 0.95) > options.maxJitterMs) {
+            degradation = "p95 pacing jitter above " + std::to_string(options.maxJitterMs) + " ms";
+        } else if (process.cpuUsage > options.maxCpuUsage) {
+            degradation = "CPU usage above " + std::to_string(options.maxCpuUsage) + "%";
+        } else {
+            sustained = healthy;
+        }
+    }
+
+    if (degradation.empty()) {
+        std::cout << "Sustained " << sustained << " concurrent calls without degradation" << std::endl;
+    } else {
+        std::cout << "Degraded: " << degradation << ", last healthy level was " << sustained << " concurrent calls" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,25 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include "process_monitor.hpp"
+
+#include <fstream>
+#include <string>
+
+namespace bench {
+    ProcessMonitor::Sample ProcessMonitor::sample() {
+        Sample result;
+        result.cpuUsage = hardwareInfo.getCpuUsage();
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.starts_with("VmRSS:")) {
+                result.residentKb = std::stoull(line.substr(6));
+            } else if (line.starts_with("Threads:")) {
+                result.threads = static_cast<uint32_t>(std::stoul(line.substr(8)));
+            }
+        }
+        return result;
+    }
+} // bench
@@ -0,0 +1,25 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "ntgcalls/utils/hardware_info.hpp"
+
+namespace bench {
+    class ProcessMonitor {
+        ntgcalls::HardwareInfo hardwareInfo;
+
+    public:
+        struct Sample {
+            double cpuUsage = 0;
+            uint64_t residentKb = 0;
+            uint32_t threads = 0;
+        };
+
+        // CPU usage is averaged over the time elapsed since the previous sample
+        Sample sample();
+    };
+} // bench
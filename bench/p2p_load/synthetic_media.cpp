@@ -0,0 +1,74 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include "synthetic_media.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include <vector>
+
+namespace bench {
+    static constexpr uint32_t kSampleRate = 48000;
+    static constexpr uint8_t kChannelCount = 2;
+    static constexpr uint16_t kWidth = 320;
+    static constexpr uint16_t kHeight = 240;
+    static constexpr uint8_t kFps = 15;
+    static constexpr int kClipSeconds = 30;
+
+    static std::string writeAudio(const std::filesystem::path& directory) {
+        const auto path = directory / "tone.pcm";
+        std::ofstream file(path, std::ios::binary);
+        std::vector<int16_t> samples(kSampleRate * kChannelCount);
+        for (int second = 0; second < kClipSeconds; second++) {
+            for (uint32_t i = 0; i < kSampleRate; i++) {
+                const auto value = static_cast<int16_t>(std::sin(2 * std::numbers::pi * 440 * i / kSampleRate) * 8000);
+                for (uint8_t channel = 0; channel < kChannelCount; channel++) {
+                    samples[i * kChannelCount + channel] = value;
+                }
+            }
+            file.write(reinterpret_cast<const char*>(samples.data()), static_cast<std::streamsize>(samples.size() * sizeof(int16_t)));
+        }
+        return path.string();
+    }
+
+    static std::string writeVideo(const std::filesystem::path& directory) {
+        const auto path = directory / "gradient.i420";
+        std::ofstream file(path, std::ios::binary);
+        std::vector<uint8_t> frame(kWidth * kHeight * 3 / 2, 128);
+        for (int index = 0; index < kClipSeconds * kFps; index++) {
+            for (int y = 0; y < kHeight; y++) {
+                for (int x = 0; x < kWidth; x++) {
+                    frame[y * kWidth + x] = static_cast<uint8_t>(x + y + index * 4);
+                }
+            }
+            file.write(reinterpret_cast<const char*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+        }
+        return path.string();
+    }
+
+    ntgcalls::MediaDescription syntheticMedia(const std::filesystem::path& directory, const bool withVideo) {
+        std::filesystem::create_directories(directory);
+        std::optional<ntgcalls::VideoDescription> video;
+        if (withVideo) {
+            video = ntgcalls::VideoDescription(
+                ntgcalls::BaseMediaDescription::InputMode::File,
+                kWidth,
+                kHeight,
+                kFps,
+                writeVideo(directory)
+            );
+        }
+        return {
+            ntgcalls::AudioDescription(
+                ntgcalls::BaseMediaDescription::InputMode::File,
+                kSampleRate,
+                16,
+                kChannelCount,
+                writeAudio(directory)
+            ),
+            video,
+        };
+    }
+} // bench
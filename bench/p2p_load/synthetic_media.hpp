@@ -0,0 +1,14 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+
+#include <filesystem>
+
+#include "ntgcalls/models/media_description.hpp"
+
+namespace bench {
+    // Writes a sine tone (and optionally a moving gradient) as raw PCM/I420 clips for the File reader
+    ntgcalls::MediaDescription syntheticMedia(const std::filesystem::path& directory, bool withVideo);
+} // bench
@@ -0,0 +1,72 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "ntgcalls/models/call_payload.hpp"
+#include "wrtc/sdp_builder.hpp"
+
+namespace bench {
+    static wrtc::Conference conference() {
+        wrtc::Conference conference;
+        conference.transport.ufrag = "1dq5b1g2pmsfta";
+        conference.transport.pwd = "4pb2fm8ap0i6qmtkbqa5kbnsjp";
+        conference.transport.fingerprints.push_back({
+            "sha-256",
+            "5B:0D:8E:3C:A4:41:8F:28:9F:0A:39:BB:C6:11:7D:1B:63:74:8F:87:5A:AD:47:15:8C:8D:94:82:19:4E:76:0E",
+        });
+        for (int i = 0; i < 4; i++) {
+            conference.transport.candidates.push_back({
+                "0",
+                "1",
+                "udp",
+                std::to_string(32000 + i),
+                "91.108.9." + std::to_string(10 + i),
+                std::to_string(i + 1),
+                randomString(8),
+                "2130706431",
+                "host",
+                "0",
+            });
+        }
+        conference.ssrc = 2938742611;
+        conference.source_groups = {1394082641, 3721938431};
+        return conference;
+    }
+
+    static void SdpFromConference(benchmark::State& state) {
+        const auto value = conference();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(wrtc::SdpBuilder::fromConference(value));
+        }
+    }
+
+    static void SdpParse(benchmark::State& state) {
+        const auto sdp = offerSdp();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(wrtc::SdpBuilder::parseSdp(sdp));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * sdp.size()));
+    }
+
+    static void CallPayloadParse(benchmark::State& state) {
+        const wrtc::Description description(wrtc::Description::SdpType::Offer, offerSdp());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(ntgcalls::CallPayload(description));
+        }
+    }
+
+    static void CallPayloadSerialize(benchmark::State& state) {
+        const ntgcalls::CallPayload payload(wrtc::Description(wrtc::Description::SdpType::Offer, offerSdp()));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(static_cast<std::string>(payload));
+        }
+    }
+
+    BENCHMARK(SdpFromConference);
+    BENCHMARK(SdpParse);
+    BENCHMARK(CallPayloadParse);
+    BENCHMARK(CallPayloadSerialize);
+} // bench
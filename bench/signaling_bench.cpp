@@ -0,0 +1,170 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include <condition_variable>
+#include <benchmark/benchmark.h>
+#include <api/environment/environment_factory.h>
+
+#include "bench_utils.hpp"
+#include "ntgcalls/signaling/signaling_sctp_connection.hpp"
+#include "ntgcalls/signaling/crypto/signaling_encryption.hpp"
+
+namespace bench {
+    // Counters only move forward, so packets are encrypted in batches and the
+    // pair of endpoints is rebuilt once a batch has been consumed
+    static constexpr size_t BatchSize = 4096;
+
+    struct EncryptedBatch {
+        std::unique_ptr<signaling::SignalingEncryption> receiver;
+        std::vector<rtc::CopyOnWriteBuffer> packets;
+    };
+
+    static EncryptedBatch encryptBatch(const rtc::CopyOnWriteBuffer& payload, const bool isRaw) {
+        signaling::SignalingEncryption sender(encryptionKey(true));
+        EncryptedBatch batch{std::make_unique<signaling::SignalingEncryption>(encryptionKey(false)), {}};
+        batch.packets.reserve(BatchSize);
+        for (size_t i = 0; i < BatchSize; i++) {
+            const auto encrypted = sender.encrypt(payload, isRaw);
+            batch.packets.emplace_back(encrypted->data(), encrypted->size());
+        }
+        return batch;
+    }
+
+    static void SignalingEncrypt(benchmark::State& state, const bool isRaw) {
+        const auto data = randomBinary(state.range(0));
+        const rtc::CopyOnWriteBuffer payload(data.data(), data.size());
+        auto sender = std::make_unique<signaling::SignalingEncryption>(encryptionKey(true));
+        size_t sent = 0;
+        for (auto _ : state) {
+            if (sent++ == BatchSize) {
+                state.PauseTiming();
+                sender = std::make_unique<signaling::SignalingEncryption>(encryptionKey(true));
+                sent = 1;
+                state.ResumeTiming();
+            }
+            benchmark::DoNotOptimize(sender->encrypt(payload, isRaw));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    static void SignalingDecrypt(benchmark::State& state, const bool isRaw) {
+        const auto data = randomBinary(state.range(0));
+        const rtc::CopyOnWriteBuffer payload(data.data(), data.size());
+        auto batch = encryptBatch(payload, isRaw);
+        size_t received = 0;
+        for (auto _ : state) {
+            if (received == BatchSize) {
+                state.PauseTiming();
+                batch = encryptBatch(payload, isRaw);
+                received = 0;
+                state.ResumeTiming();
+            }
+            benchmark::DoNotOptimize(batch.receiver->decrypt(batch.packets[received++], isRaw));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // Two SCTP signaling endpoints wired back to back through their emitters
+    class SctpPair {
+        std::unique_ptr<rtc::Thread> networkThread, signalingThread;
+        std::unique_ptr<signaling::SignalingSctpConnection> sender, receiver;
+        std::vector<rtc::CopyOnWriteBuffer> earlyPackets;
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t received = 0;
+
+    public:
+        SctpPair() {
+            networkThread = rtc::Thread::CreateWithSocketServer();
+            networkThread->Start();
+            signalingThread = rtc::Thread::Create();
+            signalingThread->Start();
+            const auto env = webrtc::CreateEnvironment();
+            // Built on the network thread so that emitters never race the construction
+            networkThread->BlockingCall([&] {
+                sender = std::make_unique<signaling::SignalingSctpConnection>(
+                    networkThread.get(),
+                    signalingThread.get(),
+                    env,
+                    encryptionKey(true),
+                    [this](const bytes::binary& data) {
+                        if (receiver) {
+                            receiver->receive(rtc::CopyOnWriteBuffer(data.data(), data.size()));
+                        } else {
+                            earlyPackets.emplace_back(data.data(), data.size());
+                        }
+                    },
+                    [](const std::vector<rtc::CopyOnWriteBuffer>&) {},
+                    true
+                );
+                receiver = std::make_unique<signaling::SignalingSctpConnection>(
+                    networkThread.get(),
+                    signalingThread.get(),
+                    env,
+                    encryptionKey(false),
+                    [this](const bytes::binary& data) {
+                        if (sender) {
+                            sender->receive(rtc::CopyOnWriteBuffer(data.data(), data.size()));
+                        }
+                    },
+                    [this](const std::vector<rtc::CopyOnWriteBuffer>& packets) {
+                        std::lock_guard lock(mutex);
+                        received += packets.size();
+                        condition.notify_all();
+                    },
+                    true
+                );
+                for (const auto& data : earlyPackets) {
+                    receiver->receive(data);
+                }
+                earlyPackets.clear();
+            });
+        }
+
+        ~SctpPair() {
+            networkThread->BlockingCall([&] {
+                receiver = nullptr;
+                sender = nullptr;
+            });
+        }
+
+        void send(const bytes::binary& data) const {
+            sender->send(data);
+        }
+
+        void waitReceived(const size_t count) {
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [&] {
+                return received >= count;
+            });
+            received -= count;
+        }
+    };
+
+    static void SignalingSctpBurst(benchmark::State& state) {
+        SctpPair pair;
+        const auto payload = randomBinary(256);
+        pair.send(payload);
+        pair.waitReceived(1);
+
+        const auto burst = static_cast<size_t>(state.range(0));
+        double submitSeconds = 0;
+        for (auto _ : state) {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < burst; i++) {
+                pair.send(payload);
+            }
+            submitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            pair.waitReceived(burst);
+        }
+        state.counters["submit_us"] = benchmark::Counter(submitSeconds * 1e6, benchmark::Counter::kAvgIterations);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * burst));
+    }
+
+    BENCHMARK_CAPTURE(SignalingEncrypt, Raw, true)->Arg(64)->Arg(1024)->Arg(8192);
+    BENCHMARK_CAPTURE(SignalingEncrypt, Packet, false)->Arg(64)->Arg(1024)->Arg(8192);
+    BENCHMARK_CAPTURE(SignalingDecrypt, Raw, true)->Arg(64)->Arg(1024)->Arg(8192);
+    BENCHMARK_CAPTURE(SignalingDecrypt, Packet, false)->Arg(64)->Arg(1024)->Arg(8192);
+    BENCHMARK(SignalingSctpBurst)->Arg(1)->Arg(16)->Arg(128)->UseRealTime()->Unit(benchmark::kMicrosecond);
+} // bench
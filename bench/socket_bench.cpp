@@ -0,0 +1,154 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include <benchmark/benchmark.h>
+#include <rtc_base/byte_order.h>
+#include <rtc_base/thread.h>
+
+#include "bench_utils.hpp"
+#include "wrtc/interfaces/network/socket_multiplexer.hpp"
+
+namespace bench {
+    // Stands in for the OS socket behind a SharedUdpSocket, packets are injected by hand
+    class LoopbackSocket final : public rtc::AsyncPacketSocket {
+        bool* closed;
+
+    public:
+        explicit LoopbackSocket(bool* closed): closed(closed) {}
+
+        ~LoopbackSocket() override {
+            *closed = true;
+        }
+
+        void inject(const bytes::binary& data, const rtc::SocketAddress& source) {
+            NotifyPacketReceived(rtc::ReceivedPacket(rtc::MakeArrayView(data.data(), data.size()), source));
+        }
+
+        rtc::SocketAddress GetLocalAddress() const override {
+            return {"127.0.0.1", 50000};
+        }
+
+        rtc::SocketAddress GetRemoteAddress() const override {
+            return {};
+        }
+
+        int Send(const void*, size_t, const rtc::PacketOptions&) override {
+            return -1;
+        }
+
+        int SendTo(const void*, const size_t size, const rtc::SocketAddress&, const rtc::PacketOptions&) override {
+            return static_cast<int>(size);
+        }
+
+        int Close() override {
+            return 0;
+        }
+
+        State GetState() const override {
+            return STATE_BOUND;
+        }
+
+        int GetOption(rtc::Socket::Option, int*) override {
+            return -1;
+        }
+
+        int SetOption(rtc::Socket::Option, int) override {
+            return 0;
+        }
+
+        int GetError() const override {
+            return 0;
+        }
+
+        void SetError(int) override {}
+    };
+
+    class LoopbackSocketFactory final : public rtc::PacketSocketFactory {
+    public:
+        LoopbackSocket* socket = nullptr;
+        bool closed = false;
+
+        rtc::AsyncPacketSocket* CreateUdpSocket(const rtc::SocketAddress&, uint16_t, uint16_t) override {
+            closed = false;
+            return socket = new LoopbackSocket(&closed);
+        }
+
+        rtc::AsyncListenSocket* CreateServerTcpSocket(const rtc::SocketAddress&, uint16_t, uint16_t, int) override {
+            return nullptr;
+        }
+
+        rtc::AsyncPacketSocket* CreateClientTcpSocket(const rtc::SocketAddress&, const rtc::SocketAddress&, const rtc::ProxyInfo&, const std::string&, const rtc::PacketSocketTcpOptions&) override {
+            return nullptr;
+        }
+
+        std::unique_ptr<webrtc::AsyncDnsResolverInterface> CreateAsyncDnsResolver() override {
+            return nullptr;
+        }
+    };
+
+    static bytes::binary stunBindingRequest(const std::string& username, const uint8_t transaction) {
+        const size_t attributeSize = 4 + ((username.size() + 3) & ~static_cast<size_t>(3));
+        bytes::binary packet(20 + attributeSize, 0);
+        rtc::SetBE16(packet.data(), 0x0001);
+        rtc::SetBE16(packet.data() + 2, static_cast<uint16_t>(attributeSize));
+        rtc::SetBE32(packet.data() + 4, 0x2112A442);
+        packet[8] = transaction;
+        rtc::SetBE16(packet.data() + 20, 0x0006);
+        rtc::SetBE16(packet.data() + 22, static_cast<uint16_t>(username.size()));
+        std::ranges::copy(username, packet.begin() + 24);
+        return packet;
+    }
+
+    // Two connections on one shared socket, every packet has to reach the
+    // connection that owns its ufrag or remote, and the OS socket has to go
+    // away once both connections are closed
+    static void SharedSocketTwoConnections(benchmark::State& state) {
+        const auto networkThread = rtc::Thread::CreateWithSocketServer();
+        networkThread->Start();
+        LoopbackSocketFactory socketFactory;
+        std::unique_ptr<wrtc::SocketMultiplexer> multiplexer;
+        std::unique_ptr<rtc::AsyncPacketSocket> first, second;
+        size_t firstReceived = 0, secondReceived = 0;
+        const rtc::SocketAddress firstRemote("10.0.0.1", 40000), secondRemote("10.0.0.2", 40000);
+        networkThread->BlockingCall([&] {
+            multiplexer = std::make_unique<wrtc::SocketMultiplexer>(&socketFactory);
+            first.reset(multiplexer->createUdpSocket(rtc::SocketAddress("0.0.0.0", 0), 0, 0, "ufragA"));
+            second.reset(multiplexer->createUdpSocket(rtc::SocketAddress("0.0.0.0", 0), 0, 0, "ufragB"));
+            first->RegisterReceivedPacketCallback([&](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket&) {
+                firstReceived++;
+            });
+            second->RegisterReceivedPacketCallback([&](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket&) {
+                secondReceived++;
+            });
+        });
+        const auto firstRequest = stunBindingRequest("ufragA:remote1", 1);
+        const auto secondRequest = stunBindingRequest("ufragB:remote2", 2);
+        const auto media = randomBinary(1200);
+        for (auto _ : state) {
+            networkThread->BlockingCall([&] {
+                socketFactory.socket->inject(firstRequest, firstRemote);
+                socketFactory.socket->inject(secondRequest, secondRemote);
+                socketFactory.socket->inject(media, firstRemote);
+                socketFactory.socket->inject(media, secondRemote);
+            });
+        }
+        if (firstReceived != secondReceived || firstReceived != static_cast<size_t>(state.iterations()) * 2) {
+            state.SkipWithError("Packets were routed to the wrong connection");
+        }
+        networkThread->BlockingCall([&] {
+            first = nullptr;
+            second = nullptr;
+        });
+        networkThread->BlockingCall([] {});
+        if (!socketFactory.closed) {
+            state.SkipWithError("Shared socket outlived its connections");
+        }
+        networkThread->BlockingCall([&] {
+            multiplexer = nullptr;
+        });
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 4);
+    }
+
+    BENCHMARK(SharedSocketTwoConnections);
+} // bench
\ No newline at end of file
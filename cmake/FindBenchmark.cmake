@@ -0,0 +1,18 @@
+set(BENCHMARK_DIR ${deps_loc}/benchmark)
+set(BENCHMARK_WORKDIR ${BENCHMARK_DIR}/src)
+
+DownloadProject(
+    URL https://github.com/google/benchmark/archive/refs/tags/v${BENCHMARK_REVISION}.tar.gz
+    DOWNLOAD_DIR ${BENCHMARK_DIR}/download
+    SOURCE_DIR ${BENCHMARK_WORKDIR}
+)
+
+set(BENCHMARK_ENABLE_TESTING OFF CACHE INTERNAL "")
+set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE INTERNAL "")
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE INTERNAL "")
+set(BENCHMARK_ENABLE_WERROR OFF CACHE INTERNAL "")
+set(BENCHMARK_USE_BUNDLED_GTEST OFF CACHE INTERNAL "")
+add_subdirectory(${BENCHMARK_WORKDIR} ${CMAKE_BINARY_DIR}/benchmark EXCLUDE_FROM_ALL)
+
+# Google Benchmark must share the libc++ ABI WebRTC was built with
+setup_platform_libs(benchmark)
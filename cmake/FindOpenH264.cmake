@@ -0,0 +1,81 @@
+set(OPENH264_DIR ${deps_loc}/openh264)
+set(OPENH264_WORKDIR ${OPENH264_DIR}/src)
+set(OPENH264_ROOT ${OPENH264_WORKDIR}/install)
+set(OPENH264_INCLUDE ${OPENH264_ROOT}/include)
+set(OPENH264_LIB ${OPENH264_ROOT}/lib/${CMAKE_STATIC_LIBRARY_PREFIX}openh264${CMAKE_STATIC_LIBRARY_SUFFIX})
+
+# BUILD CONFIGS
+if (LINUX_x86_64)
+    set(OPENH264_OS linux)
+    set(OPENH264_ARCH x86_64)
+    set(OPENH264_CXX_FLAGS
+            -D_LIBCPP_ABI_NAMESPACE=Cr
+            -D_LIBCPP_ABI_VERSION=2
+            -D_LIBCPP_DISABLE_AVAILABILITY
+            -nostdinc++
+            -isystem${LIBCXX_INCLUDE}/include
+            -fPIC
+    )
+elseif (LINUX_ARM64)
+    set(OPENH264_OS linux)
+    set(OPENH264_ARCH arm64)
+    set(OPENH264_CXX_FLAGS
+            -D_LIBCPP_ABI_NAMESPACE=Cr
+            -D_LIBCPP_ABI_VERSION=2
+            -D_LIBCPP_DISABLE_AVAILABILITY
+            -nostdinc++
+            -isystem${LIBCXX_INCLUDE}/include
+            -fPIC
+    )
+elseif (MACOS_ARM64)
+    set(OPENH264_OS darwin)
+    set(OPENH264_ARCH arm64)
+    set(OPENH264_CXX_FLAGS -fPIC)
+else ()
+    message(STATUS "[OPENH264] ${CMAKE_SYSTEM_NAME} with ${CMAKE_HOST_SYSTEM_PROCESSOR} is not supported yet")
+    return()
+endif ()
+
+if(NOT DEFINED LAST_OPENH264_REVISION OR
+        NOT "${LAST_OPENH264_REVISION}" STREQUAL "${OPENH264_REVISION}" OR
+        NOT EXISTS ${OPENH264_LIB})
+
+    DownloadProject(
+        URL https://github.com/cisco/openh264/archive/refs/tags/v${OPENH264_REVISION}.tar.gz
+        DOWNLOAD_DIR ${OPENH264_DIR}/download
+        SOURCE_DIR ${OPENH264_WORKDIR}
+    )
+
+    string (REPLACE ";" " " OPENH264_CXX_FLAGS "${OPENH264_CXX_FLAGS}")
+    set(BUILD_COMMAND
+        ${CMAKE_COMMAND} -E env CXXFLAGS=${OPENH264_CXX_FLAGS}
+        make
+        -j
+        OS=${OPENH264_OS}
+        ARCH=${OPENH264_ARCH}
+        USE_ASM=No
+        BUILDTYPE=Release
+        CC=${CMAKE_C_COMPILER}
+        CXX=${CMAKE_CXX_COMPILER}
+        PREFIX=${OPENH264_ROOT}
+        install-static
+    )
+    message(STATUS "[OPENH264] Executing build process...")
+    execute_process(COMMAND ${BUILD_COMMAND}
+        WORKING_DIRECTORY ${OPENH264_WORKDIR}
+        RESULT_VARIABLE rv
+        OUTPUT_QUIET
+        ERROR_QUIET
+    )
+    if(NOT rv EQUAL 0)
+        file(REMOVE_RECURSE ${OPENH264_ROOT})
+        string (REPLACE ";" " " BUILD_COMMAND "${BUILD_COMMAND}")
+        message(FATAL_ERROR "[OPENH264] Error while executing ${BUILD_COMMAND}, cleaning up")
+    endif ()
+    set(LAST_OPENH264_REVISION ${OPENH264_REVISION} CACHE STRING "Last openh264 revision" FORCE)
+    message(STATUS "[OPENH264] Build done")
+endif ()
+message(STATUS "openh264 v${OPENH264_REVISION}")
+
+add_compile_definitions(OPENH264_ENABLED)
+set(OPENH264_ENABLED TRUE)
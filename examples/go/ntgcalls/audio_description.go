@@ -9,6 +9,7 @@ type AudioDescription struct {
 	Input                       string
 	SampleRate                  uint32
 	BitsPerSample, ChannelCount uint8
+	Encoding                    *AudioEncoding
 }
 
 func (ctx *AudioDescription) ParseToC() C.ntg_audio_description_struct {
@@ -18,5 +19,8 @@ func (ctx *AudioDescription) ParseToC() C.ntg_audio_description_struct {
 	x.sampleRate = C.uint32_t(ctx.SampleRate)
 	x.bitsPerSample = C.uint8_t(ctx.BitsPerSample)
 	x.channelCount = C.uint8_t(ctx.ChannelCount)
+	if ctx.Encoding != nil {
+		x.encoding = ctx.Encoding.ParseToC()
+	}
 	return x
 }
@@ -0,0 +1,23 @@
+package ntgcalls
+
+//#include "ntgcalls.h"
+//#include <stdlib.h>
+import "C"
+import "unsafe"
+
+type AudioEncoding struct {
+	Bitrate    int32
+	Ptime      int32
+	Complexity int32
+	Fec, Dtx   bool
+}
+
+func (ctx *AudioEncoding) ParseToC() *C.ntg_audio_encoding_struct {
+	x := (*C.ntg_audio_encoding_struct)(C.malloc(C.size_t(unsafe.Sizeof(C.ntg_audio_encoding_struct{}))))
+	x.bitrate = C.int32_t(ctx.Bitrate)
+	x.ptime = C.int32_t(ctx.Ptime)
+	x.complexity = C.int32_t(ctx.Complexity)
+	x.fec = C.bool(ctx.Fec)
+	x.dtx = C.bool(ctx.Dtx)
+	return x
+}
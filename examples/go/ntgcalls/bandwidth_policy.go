@@ -0,0 +1,20 @@
+package ntgcalls
+
+//#include "ntgcalls.h"
+import "C"
+
+type BandwidthPolicy struct {
+	ReduceBitrate         int64
+	AudioOnlyBitrate      int64
+	ScaleResolutionDownBy float64
+	MaxFramerate          int32
+}
+
+func (ctx *BandwidthPolicy) ParseToC() C.ntg_bandwidth_policy_struct {
+	var x C.ntg_bandwidth_policy_struct
+	x.reduceBitrate = C.int64_t(ctx.ReduceBitrate)
+	x.audioOnlyBitrate = C.int64_t(ctx.AudioOnlyBitrate)
+	x.scaleResolutionDownBy = C.double(ctx.ScaleResolutionDownBy)
+	x.maxFramerate = C.int32_t(ctx.MaxFramerate)
+	return x
+}
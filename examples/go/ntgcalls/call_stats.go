@@ -0,0 +1,27 @@
+package ntgcalls
+
+type CandidatePair struct {
+	LocalAddress  string
+	LocalType     string
+	RemoteAddress string
+	RemoteType    string
+	Protocol      string
+}
+
+type CallStats struct {
+	SendBandwidth     int64
+	RecvBandwidth     int64
+	BytesSent         uint64
+	BytesReceived     uint64
+	PacketsSent       uint64
+	PacketsReceived   uint64
+	PacketsLost       int64
+	FractionLost      float64
+	RttMs             float64
+	JitterMs          float64
+	PacingJitterMs    float64
+	FramesEncoded     uint64
+	TotalEncodeTimeMs float64
+	FramesDropped     uint64
+	CandidatePair     *CandidatePair
+}
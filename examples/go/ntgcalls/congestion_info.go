@@ -0,0 +1,9 @@
+package ntgcalls
+
+type CongestionInfo struct {
+	Congested     bool
+	TargetBitrate int64
+	FractionLost  float64
+	RttMs         float64
+	Adaptation    AdaptationLevel
+}
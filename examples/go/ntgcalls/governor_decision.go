@@ -0,0 +1,8 @@
+package ntgcalls
+
+type GovernorDecision struct {
+	Action      GovernorAction
+	Level       int32
+	CpuUsage    float64
+	EncodeUsage float64
+}
@@ -1,7 +1,9 @@
 package ntgcalls
 
 //#include "ntgcalls.h"
+//#include <stdlib.h>
 import "C"
+import "unsafe"
 
 type MediaDescription struct {
 	Audio *AudioDescription
@@ -20,3 +22,14 @@ func (ctx *MediaDescription) ParseToC() C.ntg_media_description_struct {
 	}
 	return x
 }
+
+func freeMediaDescription(x C.ntg_media_description_struct) {
+	if x.audio != nil {
+		C.free(unsafe.Pointer(x.audio.input))
+		C.free(unsafe.Pointer(x.audio.encoding))
+	}
+	if x.video != nil {
+		C.free(unsafe.Pointer(x.video.input))
+		C.free(unsafe.Pointer(x.video.encoding))
+	}
+}
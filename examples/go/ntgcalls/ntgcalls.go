@@ -5,6 +5,10 @@ package ntgcalls
 //extern void handleUpgrade(uint32_t uid, int64_t chatID, ntg_media_state_struct state, void*);
 //extern void handleConnectionChange(uint32_t uid, int64_t chatID, ntg_connection_state_enum state, void*);
 //extern void handleSignal(uint32_t uid, int64_t chatID, uint8_t*, int, void*);
+//extern void handleGovernorDecision(uint32_t uid, int64_t chatID, ntg_governor_decision_struct decision, void*);
+//extern void handleBitrateChange(uint32_t uid, int64_t chatID, int64_t bitrate, void*);
+//extern void handleCongestion(uint32_t uid, int64_t chatID, ntg_congestion_struct info, void*);
+//extern void handleSetupMilestone(uint32_t uid, int64_t chatID, ntg_setup_milestone_enum milestone, int64_t elapsedMs, void*);
 import "C"
 import (
 	"fmt"
@@ -15,6 +19,10 @@ var handlerEnd = make(map[uint32][]StreamEndCallback)
 var handlerUpgrade = make(map[uint32][]UpgradeCallback)
 var handlerConnectionChange = make(map[uint32][]ConnectionChangeCallback)
 var handlerSignal = make(map[uint32][]SignalCallback)
+var handlerGovernorDecision = make(map[uint32][]GovernorDecisionCallback)
+var handlerBitrateChange = make(map[uint32][]BitrateChangeCallback)
+var handlerCongestion = make(map[uint32][]CongestionCallback)
+var handlerSetupMilestone = make(map[uint32][]SetupMilestoneCallback)
 
 func NTgCalls() *Client {
 	instance := &Client{
@@ -25,6 +33,7 @@ func NTgCalls() *Client {
 	C.ntg_on_upgrade(C.uint32_t(instance.uid), (C.ntg_upgrade_callback)(unsafe.Pointer(C.handleUpgrade)), nil)
 	C.ntg_on_signaling_data(C.uint32_t(instance.uid), (C.ntg_signaling_callback)(unsafe.Pointer(C.handleSignal)), nil)
 	C.ntg_on_connection_change(C.uint32_t(instance.uid), (C.ntg_connection_callback)(unsafe.Pointer(C.handleConnectionChange)), nil)
+	C.ntg_on_governor_decision(C.uint32_t(instance.uid), (C.ntg_governor_callback)(unsafe.Pointer(C.handleGovernorDecision)), nil)
 	return instance
 }
 
@@ -96,6 +105,74 @@ func handleConnectionChange(uid C.uint32_t, chatID C.int64_t, state C.ntg_connec
 	}
 }
 
+//export handleGovernorDecision
+func handleGovernorDecision(uid C.uint32_t, chatID C.int64_t, decision C.ntg_governor_decision_struct, _ unsafe.Pointer) {
+	goChatID := int64(chatID)
+	goUID := uint32(uid)
+	goDecision := GovernorDecision{
+		Level:       int32(decision.level),
+		CpuUsage:    float64(decision.cpuUsage),
+		EncodeUsage: float64(decision.encodeUsage),
+	}
+	if decision.action == C.NTG_GOVERNOR_DEGRADE {
+		goDecision.Action = GovernorDegrade
+	} else {
+		goDecision.Action = GovernorRestore
+	}
+	if handlerGovernorDecision[goUID] != nil {
+		for _, x0 := range handlerGovernorDecision[goUID] {
+			go x0(goChatID, goDecision)
+		}
+	}
+}
+
+//export handleBitrateChange
+func handleBitrateChange(uid C.uint32_t, chatID C.int64_t, bitrate C.int64_t, _ unsafe.Pointer) {
+	goChatID := int64(chatID)
+	goUID := uint32(uid)
+	if handlerBitrateChange[goUID] != nil {
+		for _, x0 := range handlerBitrateChange[goUID] {
+			go x0(goChatID, int64(bitrate))
+		}
+	}
+}
+
+//export handleCongestion
+func handleCongestion(uid C.uint32_t, chatID C.int64_t, info C.ntg_congestion_struct, _ unsafe.Pointer) {
+	goChatID := int64(chatID)
+	goUID := uint32(uid)
+	goInfo := CongestionInfo{
+		Congested:     bool(info.congested),
+		TargetBitrate: int64(info.targetBitrate),
+		FractionLost:  float64(info.fractionLost),
+		RttMs:         float64(info.rttMs),
+	}
+	switch info.adaptation {
+	case C.NTG_ADAPTATION_REDUCED:
+		goInfo.Adaptation = AdaptationReduced
+	case C.NTG_ADAPTATION_AUDIO_ONLY:
+		goInfo.Adaptation = AdaptationAudioOnly
+	default:
+		goInfo.Adaptation = AdaptationNone
+	}
+	if handlerCongestion[goUID] != nil {
+		for _, x0 := range handlerCongestion[goUID] {
+			go x0(goChatID, goInfo)
+		}
+	}
+}
+
+//export handleSetupMilestone
+func handleSetupMilestone(uid C.uint32_t, chatID C.int64_t, milestone C.ntg_setup_milestone_enum, elapsedMs C.int64_t, _ unsafe.Pointer) {
+	goChatID := int64(chatID)
+	goUID := uint32(uid)
+	if handlerSetupMilestone[goUID] != nil {
+		for _, x0 := range handlerSetupMilestone[goUID] {
+			go x0(goChatID, SetupMilestone(milestone), int64(elapsedMs))
+		}
+	}
+}
+
 func (ctx *Client) OnStreamEnd(callback StreamEndCallback) {
 	handlerEnd[ctx.uid] = append(handlerEnd[ctx.uid], callback)
 }
@@ -112,6 +189,10 @@ func (ctx *Client) OnSignal(callback SignalCallback) {
 	handlerSignal[ctx.uid] = append(handlerSignal[ctx.uid], callback)
 }
 
+func (ctx *Client) OnGovernorDecision(callback GovernorDecisionCallback) {
+	handlerGovernorDecision[ctx.uid] = append(handlerGovernorDecision[ctx.uid], callback)
+}
+
 func parseBool(res C.int) (bool, error) {
 	return res == 0, parseErrorCode(res)
 }
@@ -177,7 +258,9 @@ func (ctx *Client) CreateCall(chatId int64, desc MediaDescription) (string, erro
 	var buffer [1024]C.char
 	size := C.int(len(buffer))
 	f := CreateFuture()
-	C.ntg_create(C.uint32_t(ctx.uid), C.int64_t(chatId), desc.ParseToC(), &buffer[0], size, f.ParseToC())
+	descC := desc.ParseToC()
+	defer freeMediaDescription(descC)
+	C.ntg_create(C.uint32_t(ctx.uid), C.int64_t(chatId), descC, &buffer[0], size, f.ParseToC())
 	f.wait()
 	return C.GoString(&buffer[0]), parseErrorCode(*f.errCode)
 }
@@ -188,7 +271,9 @@ func (ctx *Client) CreateP2PCall(chatId int64, dhConfig DhConfig, gAHash []byte,
 	size := C.int(len(buffer))
 	gAHashC, gAHashSize := parseBytes(gAHash)
 	dhConfigC := dhConfig.ParseToC()
-	C.ntg_create_p2p(C.uint32_t(ctx.uid), C.int64_t(chatId), &dhConfigC, gAHashC, gAHashSize, desc.ParseToC(), &buffer[0], size, f.ParseToC())
+	descC := desc.ParseToC()
+	defer freeMediaDescription(descC)
+	C.ntg_create_p2p(C.uint32_t(ctx.uid), C.int64_t(chatId), &dhConfigC, gAHashC, gAHashSize, descC, &buffer[0], size, f.ParseToC())
 	f.wait()
 	return C.GoBytes(unsafe.Pointer(&buffer[0]), size), parseErrorCode(*f.errCode)
 }
@@ -262,7 +347,9 @@ func (ctx *Client) Connect(chatId int64, params string) error {
 
 func (ctx *Client) ChangeStream(chatId int64, desc MediaDescription) error {
 	f := CreateFuture()
-	C.ntg_change_stream(C.uint32_t(ctx.uid), C.int64_t(chatId), desc.ParseToC(), f.ParseToC())
+	descC := desc.ParseToC()
+	defer freeMediaDescription(descC)
+	C.ntg_change_stream(C.uint32_t(ctx.uid), C.int64_t(chatId), descC, f.ParseToC())
 	f.wait()
 	return parseErrorCode(*f.errCode)
 }
@@ -318,6 +405,99 @@ func (ctx *Client) CpuUsage() (float64, error) {
 	return float64(buffer), parseErrorCode(*f.errCode)
 }
 
+func (ctx *Client) Stats(chatId int64) (CallStats, error) {
+	f := CreateFuture()
+	var buffer C.ntg_call_stats_struct
+	C.ntg_stats(C.uint32_t(ctx.uid), C.int64_t(chatId), &buffer, f.ParseToC())
+	f.wait()
+	stats := CallStats{
+		SendBandwidth:     int64(buffer.sendBandwidth),
+		RecvBandwidth:     int64(buffer.recvBandwidth),
+		BytesSent:         uint64(buffer.bytesSent),
+		BytesReceived:     uint64(buffer.bytesReceived),
+		PacketsSent:       uint64(buffer.packetsSent),
+		PacketsReceived:   uint64(buffer.packetsReceived),
+		PacketsLost:       int64(buffer.packetsLost),
+		FractionLost:      float64(buffer.fractionLost),
+		RttMs:             float64(buffer.rttMs),
+		JitterMs:          float64(buffer.jitterMs),
+		PacingJitterMs:    float64(buffer.pacingJitterMs),
+		FramesEncoded:     uint64(buffer.framesEncoded),
+		TotalEncodeTimeMs: float64(buffer.totalEncodeTimeMs),
+		FramesDropped:     uint64(buffer.framesDropped),
+	}
+	if bool(buffer.hasCandidatePair) {
+		stats.CandidatePair = &CandidatePair{
+			LocalAddress:  C.GoString(&buffer.candidatePair.localAddress[0]),
+			LocalType:     C.GoString(&buffer.candidatePair.localType[0]),
+			RemoteAddress: C.GoString(&buffer.candidatePair.remoteAddress[0]),
+			RemoteType:    C.GoString(&buffer.candidatePair.remoteType[0]),
+			Protocol:      C.GoString(&buffer.candidatePair.protocol[0]),
+		}
+	}
+	return stats, parseErrorCode(*f.errCode)
+}
+
+func (ctx *Client) SetupTimings(chatId int64) (SetupTimings, error) {
+	f := CreateFuture()
+	var buffer C.ntg_setup_timings_struct
+	C.ntg_setup_timings(C.uint32_t(ctx.uid), C.int64_t(chatId), &buffer, f.ParseToC())
+	f.wait()
+	return SetupTimings{
+		KeyExchanged:      int64(buffer.keyExchanged),
+		LocalDescription:  int64(buffer.localDescription),
+		FirstCandidate:    int64(buffer.firstCandidate),
+		GatheringComplete: int64(buffer.gatheringComplete),
+		IceConnected:      int64(buffer.iceConnected),
+		DtlsConnected:     int64(buffer.dtlsConnected),
+		FirstMedia:        int64(buffer.firstMedia),
+	}, parseErrorCode(*f.errCode)
+}
+
+func (ctx *Client) OnSetupMilestone(callback SetupMilestoneCallback) {
+	if len(handlerSetupMilestone[ctx.uid]) == 0 {
+		C.ntg_on_setup_milestone(C.uint32_t(ctx.uid), (C.ntg_setup_milestone_callback)(unsafe.Pointer(C.handleSetupMilestone)), nil)
+	}
+	handlerSetupMilestone[ctx.uid] = append(handlerSetupMilestone[ctx.uid], callback)
+}
+
+func (ctx *Client) OnBitrateChange(callback BitrateChangeCallback) {
+	if len(handlerBitrateChange[ctx.uid]) == 0 {
+		C.ntg_on_bitrate_change(C.uint32_t(ctx.uid), (C.ntg_bitrate_callback)(unsafe.Pointer(C.handleBitrateChange)), nil)
+	}
+	handlerBitrateChange[ctx.uid] = append(handlerBitrateChange[ctx.uid], callback)
+}
+
+func (ctx *Client) OnCongestion(callback CongestionCallback) {
+	if len(handlerCongestion[ctx.uid]) == 0 {
+		C.ntg_on_congestion(C.uint32_t(ctx.uid), (C.ntg_congestion_callback)(unsafe.Pointer(C.handleCongestion)), nil)
+	}
+	handlerCongestion[ctx.uid] = append(handlerCongestion[ctx.uid], callback)
+}
+
+func (ctx *Client) SetBandwidthPolicy(policy *BandwidthPolicy) error {
+	if policy == nil {
+		return parseErrorCode(C.ntg_set_bandwidth_policy(C.uint32_t(ctx.uid), nil))
+	}
+	cPolicy := policy.ParseToC()
+	return parseErrorCode(C.ntg_set_bandwidth_policy(C.uint32_t(ctx.uid), &cPolicy))
+}
+
+func (ctx *Client) SetCpuBudget(maxUsage float64) error {
+	return parseErrorCode(C.ntg_set_cpu_budget(C.uint32_t(ctx.uid), C.double(maxUsage)))
+}
+
+func (ctx *Client) SetConnectionPoolSize(size uint32) error {
+	return parseErrorCode(C.ntg_set_connection_pool_size(C.uint32_t(ctx.uid), C.uint32_t(size)))
+}
+
+func (ctx *Client) SetPriority(chatId int64, priority int32) error {
+	f := CreateFuture()
+	C.ntg_set_priority(C.uint32_t(ctx.uid), C.int64_t(chatId), C.int32_t(priority), f.ParseToC())
+	f.wait()
+	return parseErrorCode(*f.errCode)
+}
+
 func (ctx *Client) Calls() map[int64]StreamStatus {
 	mapReturn := make(map[int64]StreamStatus)
 
@@ -354,6 +534,47 @@ func Version() string {
 	return C.GoString(&buffer[0])
 }
 
+func GetSetupHistograms() []SetupHistogram {
+	var result []SetupHistogram
+	size := C.ntg_setup_histograms(nil, 0)
+	if size <= 0 {
+		return result
+	}
+	buffer := make([]C.ntg_setup_histogram_struct, size)
+	size = C.ntg_setup_histograms(&buffer[0], size)
+	for _, histogram := range buffer[:size] {
+		result = append(result, SetupHistogram{
+			Milestone: SetupMilestone(histogram.milestone),
+			Count:     uint64(histogram.count),
+			P50:       int64(histogram.p50),
+			P90:       int64(histogram.p90),
+			P99:       int64(histogram.p99),
+			Max:       int64(histogram.max),
+		})
+	}
+	return result
+}
+
+func SetShardCount(count uint32) {
+	C.ntg_set_shard_count(C.uint32_t(count))
+}
+
+func SetSocketSharing(enabled bool) {
+	C.ntg_set_socket_sharing(C.bool(enabled))
+}
+
+func SetBatchedSend(enabled bool) {
+	C.ntg_set_batched_send(C.bool(enabled))
+}
+
+func ConfigureCertificatePool(size uint32, rotationSeconds uint32) {
+	C.ntg_configure_certificate_pool(C.uint32_t(size), C.uint32_t(rotationSeconds))
+}
+
+func SetSignalingCompression(level int, useDictionary bool) {
+	C.ntg_set_signaling_compression(C.int(level), C.bool(useDictionary))
+}
+
 func (ctx *Client) Free() {
 	C.ntg_destroy(C.uint32_t(ctx.uid))
 	delete(handlerEnd, ctx.uid)
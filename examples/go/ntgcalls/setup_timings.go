@@ -0,0 +1,22 @@
+package ntgcalls
+
+// SetupTimings holds the milliseconds elapsed since the call was created,
+// or -1 for milestones that were not reached yet
+type SetupTimings struct {
+	KeyExchanged      int64
+	LocalDescription  int64
+	FirstCandidate    int64
+	GatheringComplete int64
+	IceConnected      int64
+	DtlsConnected     int64
+	FirstMedia        int64
+}
+
+type SetupHistogram struct {
+	Milestone SetupMilestone
+	Count     uint64
+	P50       int64
+	P90       int64
+	P99       int64
+	Max       int64
+}
@@ -7,11 +7,19 @@ type StreamType int
 type ConnectionState int
 type StreamStatus int
 type InputMode int
+type EncoderSpeed int
+type GovernorAction int
+type AdaptationLevel int
+type SetupMilestone int
 
 type StreamEndCallback func(chatId int64, streamType StreamType)
 type UpgradeCallback func(chatId int64, state MediaState)
 type ConnectionChangeCallback func(chatId int64, state ConnectionState)
 type SignalCallback func(chatId int64, signal []byte)
+type GovernorDecisionCallback func(chatId int64, decision GovernorDecision)
+type BitrateChangeCallback func(chatId int64, bitrate int64)
+type CongestionCallback func(chatId int64, info CongestionInfo)
+type SetupMilestoneCallback func(chatId int64, milestone SetupMilestone, elapsedMs int64)
 
 const (
 	AudioStream StreamType = iota
@@ -25,6 +33,34 @@ const (
 	InputModeNoLatency
 )
 
+const (
+	EncoderSpeedDefault EncoderSpeed = iota
+	EncoderSpeedFast
+	EncoderSpeedBalanced
+	EncoderSpeedQuality
+)
+
+const (
+	GovernorDegrade GovernorAction = iota
+	GovernorRestore
+)
+
+const (
+	AdaptationNone AdaptationLevel = iota
+	AdaptationReduced
+	AdaptationAudioOnly
+)
+
+const (
+	SetupKeyExchanged SetupMilestone = iota
+	SetupLocalDescription
+	SetupFirstCandidate
+	SetupGatheringComplete
+	SetupIceConnected
+	SetupDtlsConnected
+	SetupFirstMedia
+)
+
 const (
 	PlayingStream StreamStatus = iota
 	PausedStream
@@ -51,3 +87,16 @@ func (ctx InputMode) ParseToC() C.ntg_input_mode_enum {
 		return C.NTG_FILE
 	}
 }
+
+func (ctx EncoderSpeed) ParseToC() C.ntg_encoder_speed_enum {
+	switch ctx {
+	case EncoderSpeedFast:
+		return C.NTG_ENCODER_SPEED_FAST
+	case EncoderSpeedBalanced:
+		return C.NTG_ENCODER_SPEED_BALANCED
+	case EncoderSpeedQuality:
+		return C.NTG_ENCODER_SPEED_QUALITY
+	default:
+		return C.NTG_ENCODER_SPEED_DEFAULT
+	}
+}
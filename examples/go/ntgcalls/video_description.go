@@ -9,6 +9,7 @@ type VideoDescription struct {
 	Input         string
 	Width, Height uint16
 	Fps           uint8
+	Encoding      *VideoEncoding
 }
 
 func (ctx *VideoDescription) ParseToC() C.ntg_video_description_struct {
@@ -18,5 +19,8 @@ func (ctx *VideoDescription) ParseToC() C.ntg_video_description_struct {
 	x.width = C.uint16_t(ctx.Width)
 	x.height = C.uint16_t(ctx.Height)
 	x.fps = C.uint8_t(ctx.Fps)
+	if ctx.Encoding != nil {
+		x.encoding = ctx.Encoding.ParseToC()
+	}
 	return x
 }
@@ -0,0 +1,25 @@
+package ntgcalls
+
+//#include "ntgcalls.h"
+//#include <stdlib.h>
+import "C"
+import "unsafe"
+
+type VideoEncoding struct {
+	MinBitrate, MaxBitrate int32
+	MaxFramerate           float64
+	ScaleResolutionDownBy  float64
+	Screencast             bool
+	Speed                  EncoderSpeed
+}
+
+func (ctx *VideoEncoding) ParseToC() *C.ntg_video_encoding_struct {
+	x := (*C.ntg_video_encoding_struct)(C.malloc(C.size_t(unsafe.Sizeof(C.ntg_video_encoding_struct{}))))
+	x.minBitrate = C.int32_t(ctx.MinBitrate)
+	x.maxBitrate = C.int32_t(ctx.MaxBitrate)
+	x.maxFramerate = C.double(ctx.MaxFramerate)
+	x.scaleResolutionDownBy = C.double(ctx.ScaleResolutionDownBy)
+	x.screencast = C.bool(ctx.Screencast)
+	x.speed = ctx.Speed.ParseToC()
+	return x
+}
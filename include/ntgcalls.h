@@ -75,11 +75,36 @@ typedef enum {
     NTG_STATE_CLOSED,
 } ntg_connection_state_enum;
 
+typedef enum {
+    NTG_ENCODER_SPEED_DEFAULT,
+    NTG_ENCODER_SPEED_FAST,
+    NTG_ENCODER_SPEED_BALANCED,
+    NTG_ENCODER_SPEED_QUALITY,
+} ntg_encoder_speed_enum;
+
+typedef struct {
+    int32_t bitrate;
+    int32_t ptime;
+    int32_t complexity;
+    bool fec;
+    bool dtx;
+} ntg_audio_encoding_struct;
+
+typedef struct {
+    int32_t minBitrate;
+    int32_t maxBitrate;
+    double maxFramerate;
+    double scaleResolutionDownBy;
+    bool screencast;
+    ntg_encoder_speed_enum speed;
+} ntg_video_encoding_struct;
+
 typedef struct {
     ntg_input_mode_enum inputMode;
     char* input;
     uint32_t sampleRate;
     uint8_t bitsPerSample, channelCount;
+    ntg_audio_encoding_struct* encoding;
 } ntg_audio_description_struct;
 
 typedef struct {
@@ -87,6 +112,7 @@ typedef struct {
     char* input;
     uint16_t width, height;
     uint8_t fps;
+    ntg_video_encoding_struct* encoding;
 } ntg_video_description_struct;
 
 typedef struct {
@@ -143,6 +169,33 @@ typedef struct {
     int sizeRandom;
 } ntg_dh_config_struct;
 
+typedef struct {
+    char localAddress[64];
+    char localType[16];
+    char remoteAddress[64];
+    char remoteType[16];
+    char protocol[8];
+} ntg_candidate_pair_struct;
+
+typedef struct {
+    int64_t sendBandwidth;
+    int64_t recvBandwidth;
+    uint64_t bytesSent;
+    uint64_t bytesReceived;
+    uint64_t packetsSent;
+    uint64_t packetsReceived;
+    int64_t packetsLost;
+    double fractionLost;
+    double rttMs;
+    double jitterMs;
+    double pacingJitterMs;
+    uint64_t framesEncoded;
+    double totalEncodeTimeMs;
+    uint64_t framesDropped;
+    bool hasCandidatePair;
+    ntg_candidate_pair_struct candidatePair;
+} ntg_call_stats_struct;
+
 typedef void (*ntg_async_callback)(void*);
 
 typedef struct {
@@ -159,6 +212,76 @@ typedef void (*ntg_connection_callback)(uint32_t, int64_t, ntg_connection_state_
 
 typedef void (*ntg_signaling_callback)(uint32_t, int64_t, uint8_t*, int, void*);
 
+typedef enum {
+    NTG_GOVERNOR_DEGRADE,
+    NTG_GOVERNOR_RESTORE
+} ntg_governor_action_enum;
+
+typedef struct {
+    ntg_governor_action_enum action;
+    int32_t level;
+    double cpuUsage;
+    double encodeUsage;
+} ntg_governor_decision_struct;
+
+typedef void (*ntg_governor_callback)(uint32_t, int64_t, ntg_governor_decision_struct, void*);
+
+typedef enum {
+    NTG_ADAPTATION_NONE,
+    NTG_ADAPTATION_REDUCED,
+    NTG_ADAPTATION_AUDIO_ONLY
+} ntg_adaptation_enum;
+
+typedef struct {
+    bool congested;
+    int64_t targetBitrate;
+    double fractionLost;
+    double rttMs;
+    ntg_adaptation_enum adaptation;
+} ntg_congestion_struct;
+
+typedef struct {
+    int64_t reduceBitrate;
+    int64_t audioOnlyBitrate;
+    double scaleResolutionDownBy;
+    int32_t maxFramerate;
+} ntg_bandwidth_policy_struct;
+
+typedef void (*ntg_bitrate_callback)(uint32_t, int64_t, int64_t, void*);
+
+typedef void (*ntg_congestion_callback)(uint32_t, int64_t, ntg_congestion_struct, void*);
+
+typedef enum {
+    NTG_SETUP_KEY_EXCHANGED,
+    NTG_SETUP_LOCAL_DESCRIPTION,
+    NTG_SETUP_FIRST_CANDIDATE,
+    NTG_SETUP_GATHERING_COMPLETE,
+    NTG_SETUP_ICE_CONNECTED,
+    NTG_SETUP_DTLS_CONNECTED,
+    NTG_SETUP_FIRST_MEDIA
+} ntg_setup_milestone_enum;
+
+typedef struct {
+    int64_t keyExchanged;
+    int64_t localDescription;
+    int64_t firstCandidate;
+    int64_t gatheringComplete;
+    int64_t iceConnected;
+    int64_t dtlsConnected;
+    int64_t firstMedia;
+} ntg_setup_timings_struct;
+
+typedef struct {
+    ntg_setup_milestone_enum milestone;
+    uint64_t count;
+    int64_t p50;
+    int64_t p90;
+    int64_t p99;
+    int64_t max;
+} ntg_setup_histogram_struct;
+
+typedef void (*ntg_setup_milestone_callback)(uint32_t, int64_t, ntg_setup_milestone_enum, int64_t, void*);
+
 typedef enum {
     NTG_LOG_DEBUG = 1 << 0,
     NTG_LOG_INFO = 1 << 1,
@@ -234,6 +357,38 @@ NTG_C_EXPORT int ntg_get_version(char* buffer, int size);
 
 NTG_C_EXPORT int ntg_cpu_usage(uint32_t uid, double *buffer, ntg_async_struct future);
 
+NTG_C_EXPORT int ntg_stats(uint32_t uid, int64_t chatID, ntg_call_stats_struct *stats, ntg_async_struct future);
+
+NTG_C_EXPORT int ntg_setup_timings(uint32_t uid, int64_t chatID, ntg_setup_timings_struct *timings, ntg_async_struct future);
+
+NTG_C_EXPORT int ntg_setup_histograms(ntg_setup_histogram_struct *buffer, int size);
+
+NTG_C_EXPORT void ntg_set_shard_count(uint32_t count);
+
+NTG_C_EXPORT void ntg_set_socket_sharing(bool enabled);
+
+NTG_C_EXPORT void ntg_set_batched_send(bool enabled);
+
+NTG_C_EXPORT void ntg_configure_certificate_pool(uint32_t size, uint32_t rotationSeconds);
+
+NTG_C_EXPORT void ntg_set_signaling_compression(int level, bool useDictionary);
+
+NTG_C_EXPORT int ntg_set_cpu_budget(uint32_t uid, double maxUsage);
+
+NTG_C_EXPORT int ntg_set_connection_pool_size(uint32_t uid, uint32_t size);
+
+NTG_C_EXPORT int ntg_set_priority(uint32_t uid, int64_t chatID, int32_t priority, ntg_async_struct future);
+
+NTG_C_EXPORT int ntg_on_governor_decision(uint32_t uid, ntg_governor_callback callback, void* userData);
+
+NTG_C_EXPORT int ntg_set_bandwidth_policy(uint32_t uid, ntg_bandwidth_policy_struct* policy);
+
+NTG_C_EXPORT int ntg_on_bitrate_change(uint32_t uid, ntg_bitrate_callback callback, void* userData);
+
+NTG_C_EXPORT int ntg_on_congestion(uint32_t uid, ntg_congestion_callback callback, void* userData);
+
+NTG_C_EXPORT int ntg_on_setup_milestone(uint32_t uid, ntg_setup_milestone_callback callback, void* userData);
+
 #ifdef __cplusplus
 }
 #endif
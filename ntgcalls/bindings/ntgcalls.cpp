@@ -112,6 +112,105 @@ ntg_media_state_struct parseMediaState(const ntgcalls::MediaState state) {
     };
 }
 
+ntg_governor_decision_struct parseGovernorDecision(const ntgcalls::GovernorDecision& decision) {
+    return ntg_governor_decision_struct{
+        decision.action == ntgcalls::GovernorDecision::Action::Degrade ? NTG_GOVERNOR_DEGRADE : NTG_GOVERNOR_RESTORE,
+        decision.level,
+        decision.cpuUsage,
+        decision.encodeUsage,
+    };
+}
+
+ntg_congestion_struct parseCongestion(const ntgcalls::CongestionInfo& info) {
+    ntg_adaptation_enum adaptation;
+    switch (info.adaptation) {
+    case ntgcalls::CongestionInfo::Adaptation::Reduced:
+        adaptation = NTG_ADAPTATION_REDUCED;
+        break;
+    case ntgcalls::CongestionInfo::Adaptation::AudioOnly:
+        adaptation = NTG_ADAPTATION_AUDIO_ONLY;
+        break;
+    default:
+        adaptation = NTG_ADAPTATION_NONE;
+        break;
+    }
+    return ntg_congestion_struct{
+        info.congested,
+        info.targetBitrate,
+        info.fractionLost,
+        info.rttMs,
+        adaptation,
+    };
+}
+
+ntg_setup_milestone_enum parseMilestone(const ntgcalls::SetupTimings::Milestone milestone) {
+    switch (milestone) {
+    case ntgcalls::SetupTimings::Milestone::KeyExchanged:
+        return NTG_SETUP_KEY_EXCHANGED;
+    case ntgcalls::SetupTimings::Milestone::LocalDescription:
+        return NTG_SETUP_LOCAL_DESCRIPTION;
+    case ntgcalls::SetupTimings::Milestone::FirstCandidate:
+        return NTG_SETUP_FIRST_CANDIDATE;
+    case ntgcalls::SetupTimings::Milestone::GatheringComplete:
+        return NTG_SETUP_GATHERING_COMPLETE;
+    case ntgcalls::SetupTimings::Milestone::IceConnected:
+        return NTG_SETUP_ICE_CONNECTED;
+    case ntgcalls::SetupTimings::Milestone::DtlsConnected:
+        return NTG_SETUP_DTLS_CONNECTED;
+    case ntgcalls::SetupTimings::Milestone::FirstMedia:
+        return NTG_SETUP_FIRST_MEDIA;
+    }
+    return {};
+}
+
+ntg_setup_timings_struct parseSetupTimings(const ntgcalls::SetupTimings& timings) {
+    return ntg_setup_timings_struct{
+        timings.keyExchanged.value_or(-1),
+        timings.localDescription.value_or(-1),
+        timings.firstCandidate.value_or(-1),
+        timings.gatheringComplete.value_or(-1),
+        timings.iceConnected.value_or(-1),
+        timings.dtlsConnected.value_or(-1),
+        timings.firstMedia.value_or(-1),
+    };
+}
+
+template <size_t N>
+void copyTruncated(const std::string& s, char (&buffer)[N]) {
+    const auto size = std::min(s.size(), N - 1);
+    std::copy_n(s.begin(), size, buffer);
+    buffer[size] = '\0';
+}
+
+ntg_call_stats_struct parseCallStats(const wrtc::CallStats& stats) {
+    ntg_call_stats_struct result{
+        stats.sendBandwidth,
+        stats.recvBandwidth,
+        stats.bytesSent,
+        stats.bytesReceived,
+        stats.packetsSent,
+        stats.packetsReceived,
+        stats.packetsLost,
+        stats.fractionLost,
+        stats.rttMs,
+        stats.jitterMs,
+        stats.pacingJitterMs,
+        stats.framesEncoded,
+        stats.totalEncodeTimeMs,
+        stats.framesDropped,
+        stats.candidatePair.has_value(),
+        {},
+    };
+    if (stats.candidatePair) {
+        copyTruncated(stats.candidatePair->localAddress, result.candidatePair.localAddress);
+        copyTruncated(stats.candidatePair->localType, result.candidatePair.localType);
+        copyTruncated(stats.candidatePair->remoteAddress, result.candidatePair.remoteAddress);
+        copyTruncated(stats.candidatePair->remoteType, result.candidatePair.remoteType);
+        copyTruncated(stats.candidatePair->protocol, result.candidatePair.protocol);
+    }
+    return result;
+}
+
 ntg_stream_status_enum parseStatus(const ntgcalls::Stream::Status status) {
     switch (status) {
         case ntgcalls::Stream::Playing:
@@ -209,6 +308,60 @@ std::pair<char**, int> copyAndReturn(const std::vector<std::string>& versions) {
     return {versionsCpp, static_cast<int>(versions.size())};
 }
 
+std::optional<wrtc::AudioEncodingProfile> parseAudioEncoding(const ntg_audio_encoding_struct* encoding) {
+    if (!encoding) {
+        return std::nullopt;
+    }
+    wrtc::AudioEncodingProfile profile;
+    if (encoding->bitrate > 0) {
+        profile.bitrate = encoding->bitrate;
+    }
+    if (encoding->ptime > 0) {
+        profile.ptime = encoding->ptime;
+    }
+    if (encoding->complexity > 0) {
+        profile.complexity = encoding->complexity;
+    }
+    profile.fec = encoding->fec;
+    profile.dtx = encoding->dtx;
+    return profile;
+}
+
+std::optional<wrtc::VideoEncodingProfile> parseVideoEncoding(const ntg_video_encoding_struct* encoding) {
+    if (!encoding) {
+        return std::nullopt;
+    }
+    wrtc::VideoEncodingProfile profile;
+    if (encoding->minBitrate > 0) {
+        profile.minBitrate = encoding->minBitrate;
+    }
+    if (encoding->maxBitrate > 0) {
+        profile.maxBitrate = encoding->maxBitrate;
+    }
+    if (encoding->maxFramerate > 0) {
+        profile.maxFramerate = encoding->maxFramerate;
+    }
+    if (encoding->scaleResolutionDownBy >= 1) {
+        profile.scaleResolutionDownBy = encoding->scaleResolutionDownBy;
+    }
+    profile.screencast = encoding->screencast;
+    switch (encoding->speed) {
+    case NTG_ENCODER_SPEED_FAST:
+        profile.speed = wrtc::VideoEncodingProfile::Speed::Fast;
+        break;
+    case NTG_ENCODER_SPEED_BALANCED:
+        profile.speed = wrtc::VideoEncodingProfile::Speed::Balanced;
+        break;
+    case NTG_ENCODER_SPEED_QUALITY:
+        profile.speed = wrtc::VideoEncodingProfile::Speed::Quality;
+        break;
+    default:
+        profile.speed = wrtc::VideoEncodingProfile::Speed::Default;
+        break;
+    }
+    return profile;
+}
+
 ntgcalls::MediaDescription parseMediaDescription(const ntg_media_description_struct& desc) {
     std::optional<ntgcalls::AudioDescription> audio;
     std::optional<ntgcalls::VideoDescription> video;
@@ -219,7 +372,8 @@ ntgcalls::MediaDescription parseMediaDescription(const ntg_media_description_str
                 desc.audio->sampleRate,
                 desc.audio->bitsPerSample,
                 desc.audio->channelCount,
-                std::string(desc.audio->input)
+                std::string(desc.audio->input),
+                parseAudioEncoding(desc.audio->encoding)
             );
         } else {
             throw ntgcalls::FFmpegError("Not supported");
@@ -232,7 +386,8 @@ ntgcalls::MediaDescription parseMediaDescription(const ntg_media_description_str
                 desc.video->width,
                 desc.video->height,
                 desc.video->fps,
-                std::string(desc.video->input)
+                std::string(desc.video->input),
+                parseVideoEncoding(desc.video->encoding)
             );
         } else {
             throw ntgcalls::FFmpegError("Not supported");
@@ -346,7 +501,7 @@ int ntg_connect_p2p(const uint32_t uid, const int64_t userId, ntg_rtc_server_str
 }
 
 int ntg_send_signaling_data(const uint32_t uid, const int64_t userId, uint8_t* buffer, const int size, ntg_async_struct future) {
-    PREPARE_ASYNC(sendSignalingData, userId, bytes::binary(buffer, buffer + size))
+    PREPARE_ASYNC(sendSignalingData, userId, rtc::CopyOnWriteBuffer(buffer, size))
     [future] {
         *future.errorCode = 0;
         future.promise(future.userData);
@@ -657,6 +812,65 @@ int ntg_cpu_usage(const uint32_t uid, double *buffer, ntg_async_struct future) {
     PREPARE_ASYNC_END
 }
 
+int ntg_stats(const uint32_t uid, const int64_t chatID, ntg_call_stats_struct* stats, ntg_async_struct future) {
+    PREPARE_ASYNC(stats, chatID)
+    [future, stats](const wrtc::CallStats& callStats) {
+        *stats = parseCallStats(callStats);
+        *future.errorCode = 0;
+        future.promise(future.userData);
+    },
+    [future](const std::exception_ptr& e) {
+        try {
+            std::rethrow_exception(e);
+        } catch (ntgcalls::InvalidUUID&) {
+            *future.errorCode = NTG_INVALID_UID;
+        } catch (ntgcalls::ConnectionNotFound&) {
+            *future.errorCode = NTG_CONNECTION_NOT_FOUND;
+        } catch (...) {
+            *future.errorCode = NTG_UNKNOWN_EXCEPTION;
+        }
+        future.promise(future.userData);
+    }
+    PREPARE_ASYNC_END
+}
+
+int ntg_setup_timings(const uint32_t uid, const int64_t chatID, ntg_setup_timings_struct* timings, ntg_async_struct future) {
+    PREPARE_ASYNC(setupTimings, chatID)
+    [future, timings](const ntgcalls::SetupTimings& setupTimings) {
+        *timings = parseSetupTimings(setupTimings);
+        *future.errorCode = 0;
+        future.promise(future.userData);
+    },
+    [future](const std::exception_ptr& e) {
+        try {
+            std::rethrow_exception(e);
+        } catch (ntgcalls::InvalidUUID&) {
+            *future.errorCode = NTG_INVALID_UID;
+        } catch (ntgcalls::ConnectionNotFound&) {
+            *future.errorCode = NTG_CONNECTION_NOT_FOUND;
+        } catch (...) {
+            *future.errorCode = NTG_UNKNOWN_EXCEPTION;
+        }
+        future.promise(future.userData);
+    }
+    PREPARE_ASYNC_END
+}
+
+int ntg_setup_histograms(ntg_setup_histogram_struct* buffer, const int size) {
+    std::vector<ntg_setup_histogram_struct> histograms;
+    for (const auto& summary : ntgcalls::NTgCalls::setupHistograms()) {
+        histograms.push_back(ntg_setup_histogram_struct{
+            parseMilestone(summary.milestone),
+            summary.count,
+            summary.p50,
+            summary.p90,
+            summary.p99,
+            summary.max,
+        });
+    }
+    return copyAndReturn(histograms, buffer, size);
+}
+
 int ntg_on_stream_end(const uint32_t uid, ntg_stream_callback callback, void* userData) {
     try {
         safeUID(uid)->onStreamEnd([uid, callback, userData](const int64_t chatId, const ntgcalls::Stream::Type type) {
@@ -709,6 +923,129 @@ int ntg_get_version(char* buffer, const int size) {
     return copyAndReturn(NTG_VERSION, buffer, size);
 }
 
+void ntg_set_shard_count(const uint32_t count) {
+    ntgcalls::NTgCalls::setShardCount(count);
+}
+
+void ntg_set_socket_sharing(const bool enabled) {
+    ntgcalls::NTgCalls::setSocketSharing(enabled);
+}
+
+void ntg_set_batched_send(const bool enabled) {
+    ntgcalls::NTgCalls::setBatchedSend(enabled);
+}
+
+void ntg_configure_certificate_pool(const uint32_t size, const uint32_t rotationSeconds) {
+    ntgcalls::NTgCalls::configureCertificatePool(size, rotationSeconds);
+}
+
+void ntg_set_signaling_compression(const int level, const bool useDictionary) {
+    ntgcalls::NTgCalls::setSignalingCompression(level, useDictionary);
+}
+
+int ntg_set_cpu_budget(const uint32_t uid, const double maxUsage) {
+    try {
+        safeUID(uid)->setCpuBudget(maxUsage);
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    }
+    return 0;
+}
+
+int ntg_set_connection_pool_size(const uint32_t uid, const uint32_t size) {
+    try {
+        safeUID(uid)->setConnectionPoolSize(size);
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    }
+    return 0;
+}
+
+int ntg_set_priority(const uint32_t uid, const int64_t chatID, const int32_t priority, ntg_async_struct future) {
+    PREPARE_ASYNC(setPriority, chatID, priority)
+    [future] {
+        *future.errorCode = 0;
+        future.promise(future.userData);
+    },
+    [future](const std::exception_ptr& e) {
+        try {
+            std::rethrow_exception(e);
+        } catch (ntgcalls::InvalidUUID&) {
+            *future.errorCode = NTG_INVALID_UID;
+        } catch (ntgcalls::ConnectionNotFound&) {
+            *future.errorCode = NTG_CONNECTION_NOT_FOUND;
+        } catch (...) {
+            *future.errorCode = NTG_UNKNOWN_EXCEPTION;
+        }
+        future.promise(future.userData);
+    }
+    PREPARE_ASYNC_END
+}
+
+int ntg_on_governor_decision(const uint32_t uid, ntg_governor_callback callback, void* userData) {
+    try {
+        safeUID(uid)->onGovernorDecision([uid, callback, userData](const int64_t chatId, const ntgcalls::GovernorDecision& decision) {
+            callback(uid, chatId, parseGovernorDecision(decision), userData);
+        });
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    }
+    return 0;
+}
+
+int ntg_set_bandwidth_policy(const uint32_t uid, ntg_bandwidth_policy_struct* policy) {
+    try {
+        std::optional<ntgcalls::BandwidthPolicy> bandwidthPolicy;
+        if (policy) {
+            bandwidthPolicy = ntgcalls::BandwidthPolicy{
+                policy->reduceBitrate,
+                policy->audioOnlyBitrate,
+                policy->scaleResolutionDownBy,
+                policy->maxFramerate,
+            };
+        }
+        safeUID(uid)->setBandwidthPolicy(bandwidthPolicy);
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    } catch (...) {
+        return NTG_UNKNOWN_EXCEPTION;
+    }
+    return 0;
+}
+
+int ntg_on_bitrate_change(const uint32_t uid, ntg_bitrate_callback callback, void* userData) {
+    try {
+        safeUID(uid)->onBitrateChange([uid, callback, userData](const int64_t chatId, const int64_t bitrate) {
+            callback(uid, chatId, bitrate, userData);
+        });
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    }
+    return 0;
+}
+
+int ntg_on_congestion(const uint32_t uid, ntg_congestion_callback callback, void* userData) {
+    try {
+        safeUID(uid)->onCongestion([uid, callback, userData](const int64_t chatId, const ntgcalls::CongestionInfo& info) {
+            callback(uid, chatId, parseCongestion(info), userData);
+        });
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    }
+    return 0;
+}
+
+int ntg_on_setup_milestone(const uint32_t uid, ntg_setup_milestone_callback callback, void* userData) {
+    try {
+        safeUID(uid)->onSetupMilestone([uid, callback, userData](const int64_t chatId, const ntgcalls::SetupTimings::Milestone milestone, const int64_t elapsedMs) {
+            callback(uid, chatId, parseMilestone(milestone), elapsedMs, userData);
+        });
+    } catch (ntgcalls::InvalidUUID&) {
+        return NTG_INVALID_UID;
+    }
+    return 0;
+}
+
 void ntg_register_logger(ntg_log_message_callback callback) {
     ntgcalls::LogSink::registerLogger([callback](const ntgcalls::LogSink::LogMessage &message) {
         auto* fileName = new char[message.file.size()];
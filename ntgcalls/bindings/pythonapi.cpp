@@ -37,8 +37,24 @@ PYBIND11_MODULE(ntgcalls, m) {
     wrapper.def("on_signaling", &ntgcalls::NTgCalls::onSignalingData, py::arg("callback"));
     wrapper.def("calls", &ntgcalls::NTgCalls::calls);
     wrapper.def("cpu_usage", &ntgcalls::NTgCalls::cpuUsage);
+    wrapper.def("stats", &ntgcalls::NTgCalls::stats, py::arg("chat_id"));
+    wrapper.def("setup_timings", &ntgcalls::NTgCalls::setupTimings, py::arg("chat_id"));
+    wrapper.def("on_setup_milestone", &ntgcalls::NTgCalls::onSetupMilestone);
+    wrapper.def("set_cpu_budget", &ntgcalls::NTgCalls::setCpuBudget, py::arg("max_usage"));
+    wrapper.def("set_connection_pool_size", &ntgcalls::NTgCalls::setConnectionPoolSize, py::arg("size"));
+    wrapper.def("set_priority", &ntgcalls::NTgCalls::setPriority, py::arg("chat_id"), py::arg("priority"));
+    wrapper.def("on_governor_decision", &ntgcalls::NTgCalls::onGovernorDecision);
+    wrapper.def("set_bandwidth_policy", &ntgcalls::NTgCalls::setBandwidthPolicy, py::arg("policy"));
+    wrapper.def("on_bitrate_change", &ntgcalls::NTgCalls::onBitrateChange);
+    wrapper.def("on_congestion", &ntgcalls::NTgCalls::onCongestion);
     wrapper.def_static("ping", &ntgcalls::NTgCalls::ping);
     wrapper.def_static("get_protocol", &ntgcalls::NTgCalls::getProtocol);
+    wrapper.def_static("set_shard_count", &ntgcalls::NTgCalls::setShardCount, py::arg("count"));
+    wrapper.def_static("set_socket_sharing", &ntgcalls::NTgCalls::setSocketSharing, py::arg("enabled"));
+    wrapper.def_static("set_batched_send", &ntgcalls::NTgCalls::setBatchedSend, py::arg("enabled"));
+    wrapper.def_static("configure_certificate_pool", &ntgcalls::NTgCalls::configureCertificatePool, py::arg("size"), py::arg("rotation_seconds"));
+    wrapper.def_static("set_signaling_compression", &ntgcalls::NTgCalls::setSignalingCompression, py::arg("level") = 9, py::arg("use_dictionary") = true);
+    wrapper.def_static("setup_histograms", &ntgcalls::NTgCalls::setupHistograms);
 
     py::enum_<ntgcalls::Stream::Type>(m, "StreamType")
             .value("AUDIO", ntgcalls::Stream::Type::Audio)
@@ -78,39 +94,149 @@ PYBIND11_MODULE(ntgcalls, m) {
                 return static_cast<ntgcalls::BaseMediaDescription::InputMode>(lhs | rhs);
             });
 
+    py::enum_<ntgcalls::GovernorDecision::Action>(m, "GovernorAction")
+            .value("DEGRADE", ntgcalls::GovernorDecision::Action::Degrade)
+            .value("RESTORE", ntgcalls::GovernorDecision::Action::Restore)
+            .export_values();
+
+    py::class_<ntgcalls::GovernorDecision>(m, "GovernorDecision")
+            .def_readonly("action", &ntgcalls::GovernorDecision::action)
+            .def_readonly("level", &ntgcalls::GovernorDecision::level)
+            .def_readonly("cpu_usage", &ntgcalls::GovernorDecision::cpuUsage)
+            .def_readonly("encode_usage", &ntgcalls::GovernorDecision::encodeUsage);
+
+    py::enum_<ntgcalls::CongestionInfo::Adaptation>(m, "AdaptationLevel")
+            .value("NONE", ntgcalls::CongestionInfo::Adaptation::None)
+            .value("REDUCED", ntgcalls::CongestionInfo::Adaptation::Reduced)
+            .value("AUDIO_ONLY", ntgcalls::CongestionInfo::Adaptation::AudioOnly)
+            .export_values();
+
+    py::class_<ntgcalls::CongestionInfo>(m, "CongestionInfo")
+            .def_readonly("congested", &ntgcalls::CongestionInfo::congested)
+            .def_readonly("target_bitrate", &ntgcalls::CongestionInfo::targetBitrate)
+            .def_readonly("fraction_lost", &ntgcalls::CongestionInfo::fractionLost)
+            .def_readonly("rtt_ms", &ntgcalls::CongestionInfo::rttMs)
+            .def_readonly("adaptation", &ntgcalls::CongestionInfo::adaptation);
+
+    py::enum_<ntgcalls::SetupTimings::Milestone>(m, "SetupMilestone")
+            .value("KEY_EXCHANGED", ntgcalls::SetupTimings::Milestone::KeyExchanged)
+            .value("LOCAL_DESCRIPTION", ntgcalls::SetupTimings::Milestone::LocalDescription)
+            .value("FIRST_CANDIDATE", ntgcalls::SetupTimings::Milestone::FirstCandidate)
+            .value("GATHERING_COMPLETE", ntgcalls::SetupTimings::Milestone::GatheringComplete)
+            .value("ICE_CONNECTED", ntgcalls::SetupTimings::Milestone::IceConnected)
+            .value("DTLS_CONNECTED", ntgcalls::SetupTimings::Milestone::DtlsConnected)
+            .value("FIRST_MEDIA", ntgcalls::SetupTimings::Milestone::FirstMedia)
+            .export_values();
+
+    py::class_<ntgcalls::SetupTimings>(m, "SetupTimings")
+            .def_readonly("key_exchanged", &ntgcalls::SetupTimings::keyExchanged)
+            .def_readonly("local_description", &ntgcalls::SetupTimings::localDescription)
+            .def_readonly("first_candidate", &ntgcalls::SetupTimings::firstCandidate)
+            .def_readonly("gathering_complete", &ntgcalls::SetupTimings::gatheringComplete)
+            .def_readonly("ice_connected", &ntgcalls::SetupTimings::iceConnected)
+            .def_readonly("dtls_connected", &ntgcalls::SetupTimings::dtlsConnected)
+            .def_readonly("first_media", &ntgcalls::SetupTimings::firstMedia);
+
+    py::class_<ntgcalls::SetupHistogram::Summary>(m, "SetupHistogram")
+            .def_readonly("milestone", &ntgcalls::SetupHistogram::Summary::milestone)
+            .def_readonly("count", &ntgcalls::SetupHistogram::Summary::count)
+            .def_readonly("p50", &ntgcalls::SetupHistogram::Summary::p50)
+            .def_readonly("p90", &ntgcalls::SetupHistogram::Summary::p90)
+            .def_readonly("p99", &ntgcalls::SetupHistogram::Summary::p99)
+            .def_readonly("max", &ntgcalls::SetupHistogram::Summary::max);
+
+    py::class_<ntgcalls::BandwidthPolicy> bandwidthPolicyWrapper(m, "BandwidthPolicy");
+    bandwidthPolicyWrapper.def(py::init<>());
+    bandwidthPolicyWrapper.def_readwrite("reduce_bitrate", &ntgcalls::BandwidthPolicy::reduceBitrate);
+    bandwidthPolicyWrapper.def_readwrite("audio_only_bitrate", &ntgcalls::BandwidthPolicy::audioOnlyBitrate);
+    bandwidthPolicyWrapper.def_readwrite("scale_resolution_down_by", &ntgcalls::BandwidthPolicy::scaleResolutionDownBy);
+    bandwidthPolicyWrapper.def_readwrite("max_framerate", &ntgcalls::BandwidthPolicy::maxFramerate);
+
     py::class_<ntgcalls::MediaState>(m, "MediaState")
             .def_readonly("muted", &ntgcalls::MediaState::muted)
             .def_readonly("video_stopped", &ntgcalls::MediaState::videoStopped)
             .def_readonly("video_paused", &ntgcalls::MediaState::videoPaused);
 
+    py::class_<wrtc::CandidatePairStats>(m, "CandidatePairStats")
+            .def_readonly("local_address", &wrtc::CandidatePairStats::localAddress)
+            .def_readonly("local_type", &wrtc::CandidatePairStats::localType)
+            .def_readonly("remote_address", &wrtc::CandidatePairStats::remoteAddress)
+            .def_readonly("remote_type", &wrtc::CandidatePairStats::remoteType)
+            .def_readonly("protocol", &wrtc::CandidatePairStats::protocol);
+
+    py::class_<wrtc::CallStats>(m, "CallStats")
+            .def_readonly("send_bandwidth", &wrtc::CallStats::sendBandwidth)
+            .def_readonly("recv_bandwidth", &wrtc::CallStats::recvBandwidth)
+            .def_readonly("bytes_sent", &wrtc::CallStats::bytesSent)
+            .def_readonly("bytes_received", &wrtc::CallStats::bytesReceived)
+            .def_readonly("packets_sent", &wrtc::CallStats::packetsSent)
+            .def_readonly("packets_received", &wrtc::CallStats::packetsReceived)
+            .def_readonly("packets_lost", &wrtc::CallStats::packetsLost)
+            .def_readonly("fraction_lost", &wrtc::CallStats::fractionLost)
+            .def_readonly("rtt_ms", &wrtc::CallStats::rttMs)
+            .def_readonly("jitter_ms", &wrtc::CallStats::jitterMs)
+            .def_readonly("pacing_jitter_ms", &wrtc::CallStats::pacingJitterMs)
+            .def_readonly("frames_encoded", &wrtc::CallStats::framesEncoded)
+            .def_readonly("total_encode_time_ms", &wrtc::CallStats::totalEncodeTimeMs)
+            .def_readonly("frames_dropped", &wrtc::CallStats::framesDropped)
+            .def_readonly("candidate_pair", &wrtc::CallStats::candidatePair);
+
+    py::enum_<wrtc::VideoEncodingProfile::Speed>(m, "EncoderSpeed")
+            .value("DEFAULT", wrtc::VideoEncodingProfile::Speed::Default)
+            .value("FAST", wrtc::VideoEncodingProfile::Speed::Fast)
+            .value("BALANCED", wrtc::VideoEncodingProfile::Speed::Balanced)
+            .value("QUALITY", wrtc::VideoEncodingProfile::Speed::Quality)
+            .export_values();
+
+    py::class_<wrtc::AudioEncodingProfile> audioEncodingWrapper(m, "AudioEncodingProfile");
+    audioEncodingWrapper.def(py::init<>());
+    audioEncodingWrapper.def_readwrite("bitrate", &wrtc::AudioEncodingProfile::bitrate);
+    audioEncodingWrapper.def_readwrite("ptime", &wrtc::AudioEncodingProfile::ptime);
+    audioEncodingWrapper.def_readwrite("complexity", &wrtc::AudioEncodingProfile::complexity);
+    audioEncodingWrapper.def_readwrite("fec", &wrtc::AudioEncodingProfile::fec);
+    audioEncodingWrapper.def_readwrite("dtx", &wrtc::AudioEncodingProfile::dtx);
+
+    py::class_<wrtc::VideoEncodingProfile> videoEncodingWrapper(m, "VideoEncodingProfile");
+    videoEncodingWrapper.def(py::init<>());
+    videoEncodingWrapper.def_readwrite("min_bitrate", &wrtc::VideoEncodingProfile::minBitrate);
+    videoEncodingWrapper.def_readwrite("max_bitrate", &wrtc::VideoEncodingProfile::maxBitrate);
+    videoEncodingWrapper.def_readwrite("max_framerate", &wrtc::VideoEncodingProfile::maxFramerate);
+    videoEncodingWrapper.def_readwrite("scale_resolution_down_by", &wrtc::VideoEncodingProfile::scaleResolutionDownBy);
+    videoEncodingWrapper.def_readwrite("screencast", &wrtc::VideoEncodingProfile::screencast);
+    videoEncodingWrapper.def_readwrite("speed", &wrtc::VideoEncodingProfile::speed);
+
     py::class_<ntgcalls::BaseMediaDescription> mediaWrapper(m, "BaseMediaDescription");
     mediaWrapper.def_readwrite("input", &ntgcalls::BaseMediaDescription::input);
 
     py::class_<ntgcalls::AudioDescription> audioWrapper(m, "AudioDescription", mediaWrapper);
     audioWrapper.def(
-            py::init<ntgcalls::BaseMediaDescription::InputMode, uint32_t, uint8_t, uint8_t, std::string>(),
+            py::init<ntgcalls::BaseMediaDescription::InputMode, uint32_t, uint8_t, uint8_t, std::string, std::optional<wrtc::AudioEncodingProfile>>(),
             py::arg("input_mode"),
             py::arg("sample_rate"),
             py::arg("bits_per_sample"),
             py::arg("channel_count"),
-            py::arg("input")
+            py::arg("input"),
+            py::arg_v("encoding", std::nullopt, "None")
     );
     audioWrapper.def_readwrite("sampleRate", &ntgcalls::AudioDescription::sampleRate);
     audioWrapper.def_readwrite("bitsPerSample", &ntgcalls::AudioDescription::bitsPerSample);
     audioWrapper.def_readwrite("channelCount", &ntgcalls::AudioDescription::channelCount);
+    audioWrapper.def_readwrite("encoding", &ntgcalls::AudioDescription::encoding);
 
     py::class_<ntgcalls::VideoDescription> videoWrapper(m, "VideoDescription", mediaWrapper);
     videoWrapper.def(
-            py::init<ntgcalls::BaseMediaDescription::InputMode, uint16_t, uint16_t, uint8_t, std::string>(),
+            py::init<ntgcalls::BaseMediaDescription::InputMode, uint16_t, uint16_t, uint8_t, std::string, std::optional<wrtc::VideoEncodingProfile>>(),
             py::arg("input_mode"),
             py::arg("width"),
             py::arg("height"),
             py::arg("fps"),
-            py::arg("input")
+            py::arg("input"),
+            py::arg_v("encoding", std::nullopt, "None")
     );
     videoWrapper.def_readwrite("width", &ntgcalls::VideoDescription::width);
     videoWrapper.def_readwrite("height", &ntgcalls::VideoDescription::height);
     videoWrapper.def_readwrite("fps", &ntgcalls::VideoDescription::fps);
+    videoWrapper.def_readwrite("encoding", &ntgcalls::VideoDescription::encoding);
 
     py::class_<ntgcalls::MediaDescription> mediaDescWrapper(m, "MediaDescription");
     mediaDescWrapper.def(
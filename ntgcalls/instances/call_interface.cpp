@@ -4,26 +4,35 @@
 
 #include "call_interface.hpp"
 
+#include "ntgcalls/utils/setup_histogram.hpp"
+
 namespace ntgcalls {
-    CallInterface::CallInterface(rtc::Thread* updateThread): updateThread(updateThread) {
-        networkThread = rtc::Thread::Create();
-        networkThread->Start();
+    CallInterface::CallInterface(rtc::Thread* updateThread): createdAt(rtc::TimeMillis()), updateThread(updateThread) {
+        timerService = wrtc::TimerService::GetOrCreateDefault();
         stream = std::make_unique<Stream>(updateThread);
+        stream->onFirstFrame([this] {
+            markMilestone(SetupTimings::Milestone::FirstMedia);
+        });
     }
 
     CallInterface::~CallInterface() {
         RTC_LOG(LS_VERBOSE) << "Destroying CallInterface";
         isExiting = true;
         std::lock_guard lock(mutex);
+        std::lock_guard encodingLock(encodingMutex);
         connectionChangeCallback = nullptr;
+        setupMilestoneCallback = nullptr;
         stream = nullptr;
         if (connection) {
             connection->onConnectionChange(nullptr);
+            connection->onSetupMilestone(nullptr);
             connection = nullptr;
             RTC_LOG(LS_VERBOSE) << "Connection closed";
         }
         updateThread = nullptr;
         cancelNetworkListener();
+        timerService = nullptr;
+        wrtc::TimerService::UnRef();
         RTC_LOG(LS_VERBOSE) << "CallInterface destroyed";
     }
 
@@ -43,8 +52,117 @@ namespace ntgcalls {
         return stream->unmute();
     }
 
-    void CallInterface::changeStream(const MediaDescription& config) const {
+    void CallInterface::changeStream(const MediaDescription& config) {
         stream->setAVStream(config);
+        updateEncoding(config);
+    }
+
+    void CallInterface::setPriority(const int value) {
+        priority = value;
+    }
+
+    int CallInterface::getPriority() const {
+        return priority;
+    }
+
+    void CallInterface::setDegradation(const int level) {
+        std::lock_guard lock(encodingMutex);
+        if (degradation == level) {
+            return;
+        }
+        degradation = level;
+        if (connection) {
+            connection->setVideoEncoding(degradedVideoEncoding());
+        }
+    }
+
+    int CallInterface::degradationLevel() {
+        std::lock_guard lock(encodingMutex);
+        return degradation;
+    }
+
+    void CallInterface::encoderStats(const std::function<void(const wrtc::EncoderStats&)>& callback) {
+        std::lock_guard lock(encodingMutex);
+        if (!connection) {
+            callback({});
+            return;
+        }
+        connection->encoderStats(callback);
+    }
+
+    wrtc::CallStats CallInterface::stats() {
+        std::lock_guard lock(encodingMutex);
+        if (!connection) {
+            return {};
+        }
+        auto stats = connection->stats();
+        stats.pacingJitterMs = stream->pacingJitter();
+        return stats;
+    }
+
+    void CallInterface::bandwidthStats(const std::function<void(const wrtc::BandwidthStats&)>& callback) {
+        std::lock_guard lock(encodingMutex);
+        if (!connection) {
+            callback({});
+            return;
+        }
+        connection->bandwidthStats(callback);
+    }
+
+    void CallInterface::setAdaptation(const CongestionInfo::Adaptation adaptation, const BandwidthPolicy& policy) const {
+        if (adaptation == CongestionInfo::Adaptation::None) {
+            stream->setVideoAdaptation(1, 0);
+        } else {
+            stream->setVideoAdaptation(policy.scaleResolutionDownBy, policy.maxFramerate);
+        }
+        stream->setAudioOnly(adaptation == CongestionInfo::Adaptation::AudioOnly);
+    }
+
+    void CallInterface::updateEncoding(const MediaDescription& config) {
+        {
+            std::lock_guard lock(encodingMutex);
+            if (config.audio && config.audio->encoding) {
+                audioEncoding = config.audio->encoding;
+            }
+            if (config.video && config.video->encoding) {
+                videoEncoding = config.video->encoding;
+            }
+        }
+        applyEncoding();
+    }
+
+    void CallInterface::applyEncoding() {
+        std::lock_guard lock(encodingMutex);
+        if (!connection) {
+            return;
+        }
+        if (audioEncoding) {
+            connection->setAudioEncoding(*audioEncoding);
+        }
+        if (videoEncoding || degradation) {
+            connection->setVideoEncoding(degradedVideoEncoding());
+        }
+    }
+
+    wrtc::VideoEncodingProfile CallInterface::degradedVideoEncoding() const {
+        auto profile = videoEncoding.value_or(wrtc::VideoEncodingProfile());
+        if (degradation >= 1) {
+            profile.speed = wrtc::VideoEncodingProfile::Speed::Fast;
+        }
+        if (degradation >= 2) {
+            profile.lightweightCodec = true;
+        }
+        if (degradation >= 3) {
+            profile.maxFramerate = std::min(profile.maxFramerate.value_or(15), 15.0);
+        }
+        if (degradation >= 4) {
+            profile.scaleResolutionDownBy = std::max(profile.scaleResolutionDownBy.value_or(2), 2.0);
+        }
+        if (degradation >= 5) {
+            profile.maxFramerate = std::min(*profile.maxFramerate, 8.0);
+            profile.scaleResolutionDownBy = std::max(*profile.scaleResolutionDownBy, 4.0);
+        }
+        return profile;
     }
 
     void CallInterface::onStreamEnd(const std::function<void(Stream::Type)>& callback) {
@@ -57,6 +175,49 @@ namespace ntgcalls {
         connectionChangeCallback = callback;
     }
 
+    void CallInterface::onSetupMilestone(const std::function<void(SetupTimings::Milestone, int64_t)>& callback) {
+        setupMilestoneCallback = callback;
+    }
+
+    SetupTimings CallInterface::timings() {
+        std::lock_guard lock(setupMutex);
+        return setupTimings;
+    }
+
+    void CallInterface::markMilestone(const SetupTimings::Milestone milestone) {
+        if (isExiting) return;
+        const auto elapsed = rtc::TimeMillis() - createdAt;
+        {
+            std::lock_guard lock(setupMutex);
+            auto& value = setupTimings[milestone];
+            if (value) {
+                return;
+            }
+            value = elapsed;
+        }
+        SetupHistogram::Add(milestone, elapsed);
+        (void) setupMilestoneCallback(milestone, elapsed);
+    }
+
+    void CallInterface::setSetupObserver() {
+        connection->onSetupMilestone([this](const wrtc::SetupMilestone milestone) {
+            switch (milestone) {
+            case wrtc::SetupMilestone::FirstCandidate:
+                markMilestone(SetupTimings::Milestone::FirstCandidate);
+                break;
+            case wrtc::SetupMilestone::GatheringComplete:
+                markMilestone(SetupTimings::Milestone::GatheringComplete);
+                break;
+            case wrtc::SetupMilestone::IceConnected:
+                markMilestone(SetupTimings::Milestone::IceConnected);
+                break;
+            case wrtc::SetupMilestone::DtlsConnected:
+                markMilestone(SetupTimings::Milestone::DtlsConnected);
+                break;
+            }
+        });
+    }
+
     uint64_t CallInterface::time() const {
         return stream->time();
     }
@@ -70,15 +231,20 @@ namespace ntgcalls {
     }
 
     void CallInterface::cancelNetworkListener() {
-        if (networkThread) {
-            networkThread->Stop();
-            networkThread = nullptr;
+        if (const auto id = timeoutTimer.exchange(0)) {
+            timerService->cancel(id);
         }
     }
 
     void CallInterface::setConnectionObserver() {
         RTC_LOG(LS_INFO) << "Connecting...";
         (void) connectionChangeCallback(ConnectionState::Connecting);
+        timeoutTimer = timerService->schedule(webrtc::TimeDelta::Seconds(20), [this] {
+            if (!connected) {
+                RTC_LOG(LS_ERROR) << "Connection timeout";
+                (void) connectionChangeCallback(ConnectionState::Timeout);
+            }
+        });
         connection->onConnectionChange([this](const wrtc::ConnectionState state) {
             if (isExiting) return;
             std::lock_guard lock(mutex);
@@ -118,11 +284,5 @@ namespace ntgcalls {
             }
             cancelNetworkListener();
         });
-        networkThread->PostDelayedTask([this] {
-            if (!connected) {
-                RTC_LOG(LS_ERROR) << "Connection timeout";
-                (void) connectionChangeCallback(ConnectionState::Timeout);
-            }
-        }, webrtc::TimeDelta::Seconds(20));
     }
 } // ntgcalls
\ No newline at end of file
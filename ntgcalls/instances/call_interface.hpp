@@ -6,12 +6,25 @@
 #include <memory>
 
 #include "ntgcalls/stream.hpp"
+#include "ntgcalls/models/bandwidth_policy.hpp"
+#include "ntgcalls/models/congestion_info.hpp"
+#include "ntgcalls/models/setup_timings.hpp"
+#include "wrtc/utils/timer_service.hpp"
 
 namespace ntgcalls {
 
     class CallInterface {
         bool connected = false;
         std::atomic_bool isExiting;
+        rtc::scoped_refptr<wrtc::TimerService> timerService;
+        std::atomic<wrtc::TimerService::TimerId> timeoutTimer = 0;
+        std::mutex encodingMutex;
+        std::atomic_int priority = 0;
+        int degradation = 0;
+        int64_t createdAt;
+        std::mutex setupMutex;
+        SetupTimings setupTimings;
+        wrtc::synchronized_callback<SetupTimings::Milestone, int64_t> setupMilestoneCallback;
 
         void cancelNetworkListener();
 
@@ -29,10 +42,21 @@ namespace ntgcalls {
         std::unique_ptr<Stream> stream;
         wrtc::synchronized_callback<ConnectionState> connectionChangeCallback;
         rtc::Thread* updateThread;
-        std::unique_ptr<rtc::Thread> networkThread;
+        std::optional<wrtc::AudioEncodingProfile> audioEncoding;
+        std::optional<wrtc::VideoEncodingProfile> videoEncoding;
 
         void setConnectionObserver();
 
+        void setSetupObserver();
+
+        void markMilestone(SetupTimings::Milestone milestone);
+
+        void updateEncoding(const MediaDescription& config);
+
+        void applyEncoding();
+
+        wrtc::VideoEncodingProfile degradedVideoEncoding() const;
+
     public:
         explicit CallInterface(rtc::Thread* updateThread);
 
@@ -53,12 +77,32 @@ namespace ntgcalls {
 
         bool unmute() const;
 
-        void changeStream(const MediaDescription& config) const;
+        void changeStream(const MediaDescription& config);
+
+        void setPriority(int value);
+
+        int getPriority() const;
+
+        void setDegradation(int level);
+
+        int degradationLevel();
+
+        void encoderStats(const std::function<void(const wrtc::EncoderStats&)>& callback);
+
+        wrtc::CallStats stats();
+
+        void bandwidthStats(const std::function<void(const wrtc::BandwidthStats&)>& callback);
+
+        void setAdaptation(CongestionInfo::Adaptation adaptation, const BandwidthPolicy& policy) const;
 
         void onStreamEnd(const std::function<void(Stream::Type)> &callback);
 
         void onConnectionChange(const std::function<void(ConnectionState)> &callback);
 
+        void onSetupMilestone(const std::function<void(SetupTimings::Milestone, int64_t)> &callback);
+
+        SetupTimings timings();
+
         uint64_t time() const;
 
         MediaState getState() const;
@@ -14,14 +14,19 @@ namespace ntgcalls {
         sourceGroups.clear();
     }
 
-    std::string GroupCall::init(const MediaDescription& config) {
+    std::string GroupCall::init(const MediaDescription& config, std::unique_ptr<wrtc::PeerConnection> warmConnection) {
         RTC_LOG(LS_INFO) << "Initializing group call";
         std::lock_guard lock(mutex);
         if (connection) {
             RTC_LOG(LS_ERROR) << "Connection already made";
             throw ConnectionError("Connection already made");
         }
-        connection = std::make_unique<wrtc::PeerConnection>();
+        if (warmConnection) {
+            connection = std::move(warmConnection);
+        } else {
+            connection = std::make_unique<wrtc::PeerConnection>();
+        }
+        setSetupObserver();
         stream->addTracks(connection);
         try {
             Safe<wrtc::PeerConnection>(connection)->setLocalDescription();
@@ -29,6 +34,7 @@ namespace ntgcalls {
             RTC_LOG(LS_ERROR) << "Failed to set local description";
             throw ConnectionError("Failed to set local description");
         }
+        markMilestone(SetupTimings::Milestone::LocalDescription);
         RTC_LOG(LS_INFO) << "Group call initialized";
         const auto payload = CallPayload(Safe<wrtc::PeerConnection>(connection)->localDescription().value());
         audioSource = payload.audioSource;
@@ -36,6 +42,7 @@ namespace ntgcalls {
             sourceGroups.push_back(ssrc);
         }
         stream->setAVStream(config, true);
+        updateEncoding(config);
         RTC_LOG(LS_INFO) << "AVStream settings applied";
         return static_cast<std::string>(payload);
     }
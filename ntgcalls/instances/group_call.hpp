@@ -4,6 +4,7 @@
 #pragma once
 #include "call_interface.hpp"
 #include "wrtc/enums.hpp"
+#include "wrtc/interfaces/peer_connection.hpp"
 
 namespace ntgcalls {
 
@@ -15,7 +16,7 @@ namespace ntgcalls {
 
         ~GroupCall() override;
 
-        std::string init(const MediaDescription& config);
+        std::string init(const MediaDescription& config, std::unique_ptr<wrtc::PeerConnection> warmConnection = nullptr);
 
         void connect(const std::string& jsonData);
 
@@ -4,10 +4,13 @@
 
 #include "p2p_call.hpp"
 
+#include <absl/strings/string_view.h>
+
 #include "ntgcalls/exceptions.hpp"
 #include "ntgcalls/signaling/crypto/mod_exp_first.hpp"
 #include "ntgcalls/signaling/messages/candidates_message.hpp"
 #include "ntgcalls/signaling/messages/candidate_message.hpp"
+#include "ntgcalls/signaling/messages/decoded_message.hpp"
 #include "ntgcalls/signaling/messages/initial_setup_message.hpp"
 #include "ntgcalls/signaling/messages/media_state_message.hpp"
 #include "ntgcalls/signaling/messages/message.hpp"
@@ -41,6 +44,7 @@ namespace ntgcalls {
         g_a_or_b = std::move(first.modexp);
         RTC_LOG(LS_INFO) << "P2P call initialized";
         stream->setAVStream(media);
+        updateEncoding(media);
         RTC_LOG(LS_INFO) << "AVStream settings applied";
         return g_a_hash ? g_a_or_b.value() : openssl::Sha256::Digest(g_a_or_b.value());
     }
@@ -87,6 +91,7 @@ namespace ntgcalls {
         }
         key = authKey;
         RTC_LOG(LS_INFO) << "Key exchanged, fingerprint: " << computedFingerprint;
+        markMilestone(SetupTimings::Milestone::KeyExchanged);
         return AuthParams{
             static_cast<int64_t>(computedFingerprint),
             this->g_a_or_b.value(),
@@ -126,6 +131,7 @@ namespace ntgcalls {
                 type() == Type::Outgoing
             );
         }
+        setSetupObserver();
         signaling = signaling::Signaling::Create(
             protocolVersion,
             connection->networkThread(),
@@ -135,7 +141,7 @@ namespace ntgcalls {
             [this](const bytes::binary &data) {
                 (void) onEmitData(data);
             },
-            [this](const std::vector<bytes::binary> &data) {
+            [this](const std::vector<rtc::CopyOnWriteBuffer> &data) {
                 for (const auto &packet : data) {
                     processSignalingData(packet);
                 }
@@ -162,6 +168,7 @@ namespace ntgcalls {
             RTC_LOG(LS_INFO) << "Data channel opened";
         });
         stream->addTracks(connection);
+        applyEncoding();
         stream->onUpgrade([this] (const MediaState mediaState) {
             sendMediaState(mediaState);
         });
@@ -173,39 +180,43 @@ namespace ntgcalls {
                 sendLocalDescription();
             } else {
                 sendInitialSetup();
+                markMilestone(SetupTimings::Milestone::LocalDescription);
                 sendOfferIfNeeded();
             }
         }
         setConnectionObserver();
     }
 
-    void P2PCall::processSignalingData(const bytes::binary& buffer) {
-        RTC_LOG(LS_INFO) << "processSignalingData: " << std::string(buffer.begin(), buffer.end());
+    void P2PCall::processSignalingData(const rtc::CopyOnWriteBuffer& buffer) {
+        // RTC_LOG formats its arguments even when the severity is filtered out
+        if (rtc::LogCheckLevel(rtc::LS_VERBOSE)) {
+            RTC_LOG(LS_VERBOSE) << "processSignalingData: " << absl::string_view(buffer.cdata<char>(), buffer.size());
+        }
         try {
-            switch (signaling::Message::type(buffer)) {
-            case signaling::Message::Type::InitialSetup: {
-                const auto message = signaling::InitialSetupMessage::deserialize(buffer);
+            auto decoded = signaling::decode(buffer);
+            if (const auto message = std::get_if<signaling::InitialSetupMessage>(&decoded)) {
+                RTC_LOG(LS_INFO) << "Received initial setup (" << buffer.size() << " bytes)";
                 wrtc::PeerIceParameters remoteIceParameters;
-                remoteIceParameters.ufrag = message->ufrag;
-                remoteIceParameters.pwd = message->pwd;
+                remoteIceParameters.ufrag = std::move(message->ufrag);
+                remoteIceParameters.pwd = std::move(message->pwd);
                 remoteIceParameters.supportsRenomination = message->supportsRenomination;
 
                 std::unique_ptr<rtc::SSLFingerprint> fingerprint;
                 std::string sslSetup;
                 if (!message->fingerprints.empty()) {
                     fingerprint = rtc::SSLFingerprint::CreateUniqueFromRfc4572(message->fingerprints[0].hash, message->fingerprints[0].fingerprint);
-                    sslSetup = message->fingerprints[0].setup;
+                    sslSetup = std::move(message->fingerprints[0].setup);
                 }
                 Safe<wrtc::NativeConnection>(connection)->setRemoteParams(remoteIceParameters, std::move(fingerprint), sslSetup);
                 handshakeCompleted = true;
                 if (type() == Type::Incoming) {
                     sendInitialSetup();
+                    markMilestone(SetupTimings::Milestone::LocalDescription);
                 }
                 applyPendingIceCandidates();
-                break;
-            }
-            case signaling::Message::Type::Candidates: {
-                for (const auto message = signaling::CandidatesMessage::deserialize(buffer); const auto&[sdpString] : message->iceCandidates) {
+            } else if (const auto message = std::get_if<signaling::CandidatesMessage>(&decoded)) {
+                RTC_LOG(LS_INFO) << "Received " << message->iceCandidates.size() << " candidates";
+                for (const auto&[sdpString] : message->iceCandidates) {
                     webrtc::JsepIceCandidate parseCandidate{ std::string(), 0 };
                     if (!parseCandidate.Initialize(sdpString, nullptr)) {
                         RTC_LOG(LS_ERROR) << "Could not parse candidate: " << sdpString;
@@ -222,27 +233,23 @@ namespace ntgcalls {
                 if (handshakeCompleted) {
                     applyPendingIceCandidates();
                 }
-                break;
-            }
-            case signaling::Message::Type::NegotiateChannels: {
-                const auto message = signaling::NegotiateChannelsMessage::deserialize(buffer);
+            } else if (const auto message = std::get_if<signaling::NegotiateChannelsMessage>(&decoded)) {
+                RTC_LOG(LS_INFO) << "Received negotiate channels (" << buffer.size() << " bytes)";
                 auto negotiationContents = std::make_unique<wrtc::ContentNegotiationContext::NegotiationContents>();
                 negotiationContents->exchangeId = message->exchangeId;
-                negotiationContents->contents = message->contents;
-                auto negotiation = message->serialize();
+                negotiationContents->contents = std::move(message->contents);
                 if (const auto response = Safe<wrtc::NativeConnection>(connection)->setPendingAnswer(std::move(negotiationContents))) {
                     signaling::NegotiateChannelsMessage channelMessage;
                     channelMessage.exchangeId = response->exchangeId;
                     channelMessage.contents = response->contents;
-                    RTC_LOG(LS_INFO) << "Sending negotiate channels: " << bytes::to_string(channelMessage.serialize());
-                    signaling->send(channelMessage.serialize());
+                    const auto serialized = channelMessage.serialize();
+                    RTC_LOG(LS_VERBOSE) << "Sending negotiate channels: " << bytes::to_string(serialized);
+                    signaling->send(serialized);
                 }
                 sendOfferIfNeeded();
                 Safe<wrtc::NativeConnection>(connection)->createChannels();
-                break;
-            }
-            case signaling::Message::Type::RtcDescription: {
-                const auto message = signaling::RtcDescriptionMessage::deserialize(buffer);
+            } else if (const auto message = std::get_if<signaling::RtcDescriptionMessage>(&decoded)) {
+                RTC_LOG(LS_INFO) << "Received remote description (" << buffer.size() << " bytes)";
                 if (
                     type() == Type::Outgoing &&
                     message->type == wrtc::Description::SdpType::Offer &&
@@ -254,10 +261,7 @@ namespace ntgcalls {
                     message->type,
                     message->sdp
                 );
-                break;
-            }
-            case signaling::Message::Type::Candidate: {
-                const auto message = signaling::CandidateMessage::deserialize(buffer);
+            } else if (const auto message = std::get_if<signaling::CandidateMessage>(&decoded)) {
                 const auto candidate = wrtc::IceCandidate(
                     message->mid,
                     message->mLine,
@@ -268,10 +272,6 @@ namespace ntgcalls {
                 } else {
                     pendingIceCandidates.push_back(candidate);
                 }
-                break;
-            }
-            default:
-                break;
             }
         } catch (InvalidParams& e) {
             RTC_LOG(LS_ERROR) << "Invalid params: " << e.what();
@@ -294,6 +294,7 @@ namespace ntgcalls {
                 RTC_LOG(LS_INFO) << "Sending local description: " << bytes::to_string(message.serialize());
                 signaling->send(message.serialize());
                 isMakingOffer = false;
+                markMilestone(SetupTimings::Milestone::LocalDescription);
             });
         }, [this](const std::exception_ptr&) {});
     }
@@ -394,7 +395,7 @@ namespace ntgcalls {
         onEmitData = callback;
     }
 
-    void P2PCall::sendSignalingData(const bytes::binary& buffer) {
+    void P2PCall::sendSignalingData(const rtc::CopyOnWriteBuffer& buffer) {
         std::lock_guard lock(mutex);
         if (!signaling) {
             throw ConnectionError("Connection not initialized");
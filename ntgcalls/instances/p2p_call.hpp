@@ -25,7 +25,7 @@ namespace ntgcalls {
         std::vector<wrtc::IceCandidate> pendingIceCandidates;
         signaling::Signaling::Version protocolVersion = signaling::Signaling::Version::Unknown;
 
-        void processSignalingData(const bytes::binary& buffer);
+        void processSignalingData(const rtc::CopyOnWriteBuffer& buffer);
 
         void sendLocalDescription();
 
@@ -54,7 +54,7 @@ namespace ntgcalls {
 
         void onSignalingData(const std::function<void(const bytes::binary&)>& callback);
 
-        void sendSignalingData(const bytes::binary& buffer);
+        void sendSignalingData(const rtc::CopyOnWriteBuffer& buffer);
     };
 
 } // ntgcalls
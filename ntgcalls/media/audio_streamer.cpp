@@ -16,8 +16,8 @@ namespace ntgcalls {
         audio = nullptr;
     }
 
-    rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> AudioStreamer::createTrack() {
-        return audio->createTrack();
+    rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> AudioStreamer::createTrack(const rtc::scoped_refptr<wrtc::PeerConnectionFactory>& factory) {
+        return audio->createTrack(factory);
     }
 
     std::chrono::nanoseconds AudioStreamer::frameTime() {
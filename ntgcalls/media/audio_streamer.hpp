@@ -26,7 +26,7 @@ namespace ntgcalls {
 
         ~AudioStreamer();
 
-        rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> createTrack() override;
+        rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> createTrack(const rtc::scoped_refptr<wrtc::PeerConnectionFactory>& factory) override;
 
         void sendData(uint8_t* sample, int64_t absolute_capture_timestamp_ms) override;
 
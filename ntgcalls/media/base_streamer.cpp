@@ -4,13 +4,21 @@
 
 #include "base_streamer.hpp"
 
+#include <cmath>
+
 namespace ntgcalls {
     BaseStreamer::~BaseStreamer() {
         clear();
     }
 
     void BaseStreamer::sendData(uint8_t* sample, const int64_t absolute_capture_timestamp_ms) {
-        lastTime = std::chrono::high_resolution_clock::now();
+        const auto now = std::chrono::high_resolution_clock::now();
+        if (sentFrames > 0) {
+            // RFC 3550 style running estimate of how far each frame strays from its slot
+            const auto deviation = std::chrono::duration<double, std::milli>(now - lastTime - frameTime()).count();
+            jitter = jitter + (std::abs(deviation) - jitter) / 16;
+        }
+        lastTime = now;
         sentFrames++;
     }
 
@@ -26,7 +34,12 @@ namespace ntgcalls {
         return lastTime - std::chrono::high_resolution_clock::now() + frameTime();
     }
 
+    double BaseStreamer::pacingJitter() const {
+        return jitter;
+    }
+
     void BaseStreamer::clear() {
         sentFrames = 0;
+        jitter = 0;
     }
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <wrtc/wrtc.hpp>
 
@@ -11,6 +12,7 @@ namespace ntgcalls {
     class BaseStreamer {
         uint64_t sentFrames = 0;
         std::chrono::time_point<std::chrono::high_resolution_clock> lastTime;
+        std::atomic<double> jitter = 0;
 
     protected:
         ~BaseStreamer();
@@ -26,7 +28,9 @@ namespace ntgcalls {
 
         std::chrono::nanoseconds waitTime();
 
-        virtual rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> createTrack() = 0;
+        double pacingJitter() const;
+
+        virtual rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> createTrack(const rtc::scoped_refptr<wrtc::PeerConnectionFactory>& factory) = 0;
 
         virtual void sendData(uint8_t* sample, int64_t absolute_capture_timestamp_ms);
 
@@ -4,6 +4,8 @@
 
 #include "video_streamer.hpp"
 
+#include <algorithm>
+
 namespace ntgcalls {
     VideoStreamer::VideoStreamer() {
         video = std::make_unique<wrtc::RTCVideoSource>();
@@ -20,20 +22,31 @@ namespace ntgcalls {
         return std::chrono::microseconds(static_cast<uint64_t>(1000.0 * 1000.0 / static_cast<double_t>(fps))); // ms
     }
 
-    rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> VideoStreamer::createTrack() {
-        return video->createTrack();
+    rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> VideoStreamer::createTrack(const rtc::scoped_refptr<wrtc::PeerConnectionFactory>& factory) {
+        return video->createTrack(factory);
     }
 
     void VideoStreamer::sendData(uint8_t* sample, const int64_t absolute_capture_timestamp_ms) {
         BaseStreamer::sendData(sample, absolute_capture_timestamp_ms);
-        video->OnFrame(
-            wrtc::i420ImageData(
-                w,
-                h,
-                sample
-            ),
-            absolute_capture_timestamp_ms
-        );
+        if (const int limit = maxFps; limit > 0 && limit < fps) {
+            frameCredit += static_cast<double>(limit) / fps;
+            if (frameCredit < 1) {
+                return;
+            }
+            frameCredit -= 1;
+        }
+        const wrtc::i420ImageData frame(w, h, sample);
+        if (const double scale = scaleDown; scale > 1) {
+            video->OnFrame(
+                frame.scaledBuffer(
+                    std::max(2, static_cast<int>(w / scale) & ~1),
+                    std::max(2, static_cast<int>(h / scale) & ~1)
+                ),
+                absolute_capture_timestamp_ms
+            );
+        } else {
+            video->OnFrame(frame, absolute_capture_timestamp_ms);
+        }
     }
 
     int64_t VideoStreamer::frameSize() {
@@ -47,5 +60,11 @@ namespace ntgcalls {
         fps = framesPerSecond;
         RTC_LOG(LS_INFO) << "VideoStreamer configured with " << w << "x" << h << "@" << fps << "fps";
     }
+
+    void VideoStreamer::setAdaptation(const double scaleResolutionDownBy, const int maxFramerate) {
+        scaleDown = std::max(1.0, scaleResolutionDownBy);
+        maxFps = std::max(0, maxFramerate);
+        RTC_LOG(LS_INFO) << "VideoStreamer adapted with scale " << scaleDown << ", max fps " << maxFps;
+    }
 }
 
@@ -20,6 +20,9 @@ namespace ntgcalls {
         std::unique_ptr<wrtc::RTCVideoSource> video;
         uint16_t w = 0, h = 0;
         uint8_t fps = 0;
+        std::atomic<double> scaleDown = 1;
+        std::atomic_int maxFps = 0;
+        double frameCredit = 0;
 
         std::chrono::nanoseconds frameTime() override;
 
@@ -28,13 +31,15 @@ namespace ntgcalls {
 
         ~VideoStreamer();
 
-        rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> createTrack() override;
+        rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> createTrack(const rtc::scoped_refptr<wrtc::PeerConnectionFactory>& factory) override;
 
         void sendData(uint8_t* sample, int64_t absolute_capture_timestamp_ms) override;
 
         int64_t frameSize() override;
 
         void setConfig(uint16_t width, uint16_t height, uint8_t framesPerSecond);
+
+        void setAdaptation(double scaleResolutionDownBy, int maxFramerate);
     };
 }
 
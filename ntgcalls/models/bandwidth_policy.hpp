@@ -0,0 +1,18 @@
+//
+// Created by Laky64 on 17/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ntgcalls {
+
+    struct BandwidthPolicy {
+        int64_t reduceBitrate = 500 * 1000;
+        int64_t audioOnlyBitrate = 150 * 1000;
+        double scaleResolutionDownBy = 2;
+        int maxFramerate = 15;
+    };
+
+} // ntgcalls
@@ -0,0 +1,25 @@
+//
+// Created by Laky64 on 17/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ntgcalls {
+
+    struct CongestionInfo {
+        enum class Adaptation {
+            None,
+            Reduced,
+            AudioOnly,
+        };
+
+        bool congested;
+        int64_t targetBitrate;
+        double fractionLost;
+        double rttMs;
+        Adaptation adaptation;
+    };
+
+} // ntgcalls
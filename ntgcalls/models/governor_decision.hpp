@@ -0,0 +1,21 @@
+//
+// Created by Laky64 on 15/09/2024.
+//
+
+#pragma once
+
+namespace ntgcalls {
+
+    struct GovernorDecision {
+        enum class Action {
+            Degrade,
+            Restore,
+        };
+
+        Action action;
+        int level;
+        double cpuUsage;
+        double encodeUsage;
+    };
+
+} // ntgcalls
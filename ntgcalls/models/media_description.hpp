@@ -8,6 +8,8 @@
 #include <string>
 #include <utility>
 
+#include "wrtc/models/encoding_profile.hpp"
+
 namespace ntgcalls {
     class BaseMediaDescription {
     public:
@@ -55,18 +57,20 @@ namespace ntgcalls {
     public:
         uint32_t sampleRate;
         uint8_t bitsPerSample, channelCount;
+        std::optional<wrtc::AudioEncodingProfile> encoding;
 
-        AudioDescription(const InputMode inputMode, const uint32_t sampleRate, const uint8_t bitsPerSample, const uint8_t channelCount, const std::string& input):
-                BaseMediaDescription(input, inputMode), sampleRate(sampleRate), bitsPerSample(bitsPerSample), channelCount(channelCount) {};
+        AudioDescription(const InputMode inputMode, const uint32_t sampleRate, const uint8_t bitsPerSample, const uint8_t channelCount, const std::string& input, const std::optional<wrtc::AudioEncodingProfile>& encoding = std::nullopt):
+                BaseMediaDescription(input, inputMode), sampleRate(sampleRate), bitsPerSample(bitsPerSample), channelCount(channelCount), encoding(encoding) {};
     };
 
     class VideoDescription: public BaseMediaDescription {
     public:
         uint16_t width, height;
         uint8_t fps;
+        std::optional<wrtc::VideoEncodingProfile> encoding;
 
-        VideoDescription(const InputMode inputMode, const uint16_t width, const uint16_t height, const uint8_t fps, const std::string& input):
-                BaseMediaDescription(input, inputMode), width(width), height(height), fps(fps) {}
+        VideoDescription(const InputMode inputMode, const uint16_t width, const uint16_t height, const uint8_t fps, const std::string& input, const std::optional<wrtc::VideoEncodingProfile>& encoding = std::nullopt):
+                BaseMediaDescription(input, inputMode), width(width), height(height), fps(fps), encoding(encoding) {}
     };
 
     class MediaDescription {
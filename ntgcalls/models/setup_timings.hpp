@@ -0,0 +1,54 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace ntgcalls {
+
+    struct SetupTimings {
+        enum class Milestone {
+            KeyExchanged,
+            LocalDescription,
+            FirstCandidate,
+            GatheringComplete,
+            IceConnected,
+            DtlsConnected,
+            FirstMedia,
+        };
+
+        static constexpr size_t MilestoneCount = 7;
+
+        // Milliseconds elapsed since the call was created
+        std::optional<int64_t> keyExchanged;
+        std::optional<int64_t> localDescription;
+        std::optional<int64_t> firstCandidate;
+        std::optional<int64_t> gatheringComplete;
+        std::optional<int64_t> iceConnected;
+        std::optional<int64_t> dtlsConnected;
+        std::optional<int64_t> firstMedia;
+
+        std::optional<int64_t>& operator[](const Milestone milestone) {
+            switch (milestone) {
+            case Milestone::KeyExchanged:
+                return keyExchanged;
+            case Milestone::LocalDescription:
+                return localDescription;
+            case Milestone::FirstCandidate:
+                return firstCandidate;
+            case Milestone::GatheringComplete:
+                return gatheringComplete;
+            case Milestone::IceConnected:
+                return iceConnected;
+            case Milestone::DtlsConnected:
+                return dtlsConnected;
+            default:
+                return firstMedia;
+            }
+        }
+    };
+
+} // ntgcalls
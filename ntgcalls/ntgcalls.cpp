@@ -16,14 +16,36 @@ namespace ntgcalls {
         updateThread = rtc::Thread::Create();
         updateThread->Start();
         hardwareInfo = std::make_unique<HardwareInfo>();
+        const auto callsProvider = [this] {
+            std::lock_guard lock(mutex);
+            std::vector<std::pair<int64_t, std::shared_ptr<CallInterface>>> calls;
+            for (const auto& [chatId, call] : connections) {
+                calls.emplace_back(chatId, call);
+            }
+            return calls;
+        };
+        cpuGovernor = std::make_unique<CpuGovernor>(updateThread.get(), callsProvider);
+        cpuGovernor->onDecision([this](const int64_t chatId, const GovernorDecision& decision) {
+            THREAD_SAFE
+            (void) governorCallback(chatId, decision);
+            END_THREAD_SAFE
+        });
+        bandwidthMonitor = std::make_unique<BandwidthMonitor>(updateThread.get(), callsProvider);
+        connectionPool = std::make_unique<ConnectionPool>(updateThread.get());
         INIT_ASYNC
         LogSink::GetOrCreate();
+        certificatePool = wrtc::CertificatePool::GetOrCreateDefault();
     }
 
     NTgCalls::~NTgCalls() {
 #ifdef PYTHON_ENABLED
         py::gil_scoped_release release;
 #endif
+        updateThread->BlockingCall([this] {
+            cpuGovernor = nullptr;
+            bandwidthMonitor = nullptr;
+            connectionPool = nullptr;
+        });
         std::unique_lock lock(mutex);
         RTC_LOG(LS_VERBOSE) << "Destroying NTgCalls";
         connections = {};
@@ -33,6 +55,8 @@ namespace ntgcalls {
         updateThread = nullptr;
         DESTROY_ASYNC
         RTC_LOG(LS_VERBOSE) << "NTgCalls destroyed";
+        certificatePool = nullptr;
+        wrtc::CertificatePool::UnRef();
         LogSink::UnRef();
     }
 
@@ -69,6 +93,13 @@ namespace ntgcalls {
             END_THREAD_SAFE
             END_WORKER
         });
+        connections[chatId]->onSetupMilestone([this, chatId](const SetupTimings::Milestone milestone, const int64_t elapsedMs) {
+            WORKER("onSetupMilestone", updateThread, this, chatId, milestone, elapsedMs)
+            THREAD_SAFE
+            (void) setupMilestoneCallback(chatId, milestone, elapsedMs);
+            END_THREAD_SAFE
+            END_WORKER
+        });
         if (connections[chatId]->type() & CallInterface::Type::P2P) {
             SafeCall<P2PCall>(connections[chatId].get())->onSignalingData([this, chatId](const bytes::binary& data) {
                 WORKER("onSignalingData", updateThread, this, chatId, data)
@@ -111,7 +142,7 @@ namespace ntgcalls {
         CHECK_AND_THROW_IF_EXISTS(chatId)
         connections[chatId] = std::make_shared<GroupCall>(updateThread.get());
         setupListeners(chatId);
-        return SafeCall<GroupCall>(connections[chatId].get())->init(media);
+        return SafeCall<GroupCall>(connections[chatId].get())->init(media, connectionPool->take());
         END_ASYNC
     }
 
@@ -172,13 +203,18 @@ namespace ntgcalls {
        connectionChangeCallback = callback;
     }
 
+    void NTgCalls::onSetupMilestone(const std::function<void(int64_t, SetupTimings::Milestone, int64_t)>& callback) {
+        std::lock_guard lock(mutex);
+        setupMilestoneCallback = callback;
+    }
+
     void NTgCalls::onSignalingData(const std::function<void(int64_t, const BYTES(bytes::binary)&)>& callback) {
         std::lock_guard lock(mutex);
         emitCallback = callback;
     }
 
-    ASYNC_RETURN(void) NTgCalls::sendSignalingData(const int64_t chatId, const BYTES(bytes::binary) &msgKey) {
-        SMART_ASYNC(this, chatId, msgKey = CPP_BYTES(msgKey, bytes::binary))
+    ASYNC_RETURN(void) NTgCalls::sendSignalingData(const int64_t chatId, const BYTES(rtc::CopyOnWriteBuffer) &msgKey) {
+        SMART_ASYNC(this, chatId, msgKey = CPP_BYTES(msgKey, rtc::CopyOnWriteBuffer))
         SafeCall<P2PCall>(safeConnection(chatId))->sendSignalingData(msgKey);
         END_ASYNC
     }
@@ -201,6 +237,22 @@ namespace ntgcalls {
         END_ASYNC
     }
 
+    ASYNC_RETURN(wrtc::CallStats) NTgCalls::stats(const int64_t chatId) {
+        SMART_ASYNC(this, chatId)
+        return safeConnection(chatId)->stats();
+        END_ASYNC
+    }
+
+    ASYNC_RETURN(SetupTimings) NTgCalls::setupTimings(const int64_t chatId) {
+        SMART_ASYNC(this, chatId)
+        return safeConnection(chatId)->timings();
+        END_ASYNC
+    }
+
+    std::vector<SetupHistogram::Summary> NTgCalls::setupHistograms() {
+        return SetupHistogram::Snapshot();
+    }
+
     ASYNC_RETURN(std::map<int64_t, Stream::Status>) NTgCalls::calls() {
         SMART_ASYNC(this)
         std::map<int64_t, Stream::Status> statusList;
@@ -260,4 +312,67 @@ namespace ntgcalls {
     std::string NTgCalls::ping() {
         return "pong";
     }
+
+    void NTgCalls::setShardCount(const uint32_t count) {
+        wrtc::PeerConnectionFactory::SetShardCount(count);
+    }
+
+    void NTgCalls::setSocketSharing(const bool enabled) {
+        wrtc::PeerConnectionFactory::SetSocketSharing(enabled);
+    }
+
+    void NTgCalls::setBatchedSend(const bool enabled) {
+        wrtc::PeerConnectionFactory::SetBatchedSend(enabled);
+    }
+
+    void NTgCalls::configureCertificatePool(const uint32_t size, const uint32_t rotationSeconds) {
+        wrtc::CertificatePool::Configure(size, webrtc::TimeDelta::Seconds(rotationSeconds));
+    }
+
+    void NTgCalls::setSignalingCompression(const int level, const bool useDictionary) {
+        signaling::SignalingInterface::SetCompression(level, useDictionary);
+    }
+
+    void NTgCalls::setCpuBudget(const double maxUsage) const {
+        cpuGovernor->setBudget(maxUsage);
+    }
+
+    void NTgCalls::setConnectionPoolSize(const uint32_t size) const {
+        connectionPool->setSize(size);
+    }
+
+    ASYNC_RETURN(void) NTgCalls::setPriority(const int64_t chatId, const int priority) {
+        SMART_ASYNC(this, chatId, priority)
+        safeConnection(chatId)->setPriority(priority);
+        END_ASYNC
+    }
+
+    void NTgCalls::onGovernorDecision(const std::function<void(int64_t, GovernorDecision)>& callback) {
+        std::lock_guard lock(mutex);
+        governorCallback = callback;
+    }
+
+    void NTgCalls::setBandwidthPolicy(const std::optional<BandwidthPolicy>& policy) const {
+        bandwidthMonitor->setPolicy(policy);
+    }
+
+    void NTgCalls::onBitrateChange(const std::function<void(int64_t, int64_t)>& callback) {
+        std::lock_guard lock(mutex);
+        bitrateCallback = callback;
+        bandwidthMonitor->onBitrateChange([this](const int64_t chatId, const int64_t bitrate) {
+            THREAD_SAFE
+            (void) bitrateCallback(chatId, bitrate);
+            END_THREAD_SAFE
+        });
+    }
+
+    void NTgCalls::onCongestion(const std::function<void(int64_t, CongestionInfo)>& callback) {
+        std::lock_guard lock(mutex);
+        congestionCallback = callback;
+        bandwidthMonitor->onCongestion([this](const int64_t chatId, const CongestionInfo& info) {
+            THREAD_SAFE
+            (void) congestionCallback(chatId, info);
+            END_THREAD_SAFE
+        });
+    }
 } // ntgcalls
\ No newline at end of file
@@ -9,12 +9,21 @@
 #include "instances/call_interface.hpp"
 // ReSharper disable once CppUnusedIncludeDirective
 #include "models/auth_params.hpp"
+#include "models/bandwidth_policy.hpp"
+#include "models/congestion_info.hpp"
 #include "models/dh_config.hpp"
+#include "models/governor_decision.hpp"
 #include "models/protocol.hpp"
 #include "models/rtc_server.hpp"
+#include "models/setup_timings.hpp"
+#include "utils/bandwidth_monitor.hpp"
 #include "utils/binding_utils.hpp"
+#include "utils/connection_pool.hpp"
+#include "utils/cpu_governor.hpp"
 #include "utils/hardware_info.hpp"
 #include "utils/log_sink_impl.hpp"
+#include "utils/setup_histogram.hpp"
+#include "wrtc/utils/certificate_pool.hpp"
 
 #define CHECK_AND_THROW_IF_EXISTS(chatId) \
 if (exists(chatId)) { \
@@ -32,8 +41,16 @@ namespace ntgcalls {
         wrtc::synchronized_callback<int64_t, MediaState> mediaStateCallback;
         wrtc::synchronized_callback<int64_t, CallInterface::ConnectionState> connectionChangeCallback;
         wrtc::synchronized_callback<int64_t, BYTES(bytes::binary)> emitCallback;
+        wrtc::synchronized_callback<int64_t, GovernorDecision> governorCallback;
+        wrtc::synchronized_callback<int64_t, int64_t> bitrateCallback;
+        wrtc::synchronized_callback<int64_t, CongestionInfo> congestionCallback;
+        wrtc::synchronized_callback<int64_t, SetupTimings::Milestone, int64_t> setupMilestoneCallback;
         std::unique_ptr<rtc::Thread> updateThread;
         std::unique_ptr<HardwareInfo> hardwareInfo;
+        std::unique_ptr<CpuGovernor> cpuGovernor;
+        std::unique_ptr<BandwidthMonitor> bandwidthMonitor;
+        std::unique_ptr<ConnectionPool> connectionPool;
+        rtc::scoped_refptr<wrtc::CertificatePool> certificatePool;
         std::mutex mutex;
         ASYNC_ARGS
 
@@ -81,19 +98,51 @@ namespace ntgcalls {
 
         ASYNC_RETURN(double) cpuUsage() const;
 
+        ASYNC_RETURN(wrtc::CallStats) stats(int64_t chatId);
+
+        ASYNC_RETURN(SetupTimings) setupTimings(int64_t chatId);
+
+        static std::vector<SetupHistogram::Summary> setupHistograms();
+
         static std::string ping();
 
         static Protocol getProtocol();
 
+        static void setShardCount(uint32_t count);
+
+        static void setSocketSharing(bool enabled);
+
+        static void setBatchedSend(bool enabled);
+
+        static void configureCertificatePool(uint32_t size, uint32_t rotationSeconds);
+
+        static void setSignalingCompression(int level, bool useDictionary);
+
+        void setCpuBudget(double maxUsage) const;
+
+        void setConnectionPoolSize(uint32_t size) const;
+
+        ASYNC_RETURN(void) setPriority(int64_t chatId, int priority);
+
+        void onGovernorDecision(const std::function<void(int64_t, GovernorDecision)>& callback);
+
+        void setBandwidthPolicy(const std::optional<BandwidthPolicy>& policy) const;
+
+        void onBitrateChange(const std::function<void(int64_t, int64_t)>& callback);
+
+        void onCongestion(const std::function<void(int64_t, CongestionInfo)>& callback);
+
         void onUpgrade(const std::function<void(int64_t, MediaState)>& callback);
 
         void onStreamEnd(const std::function<void(int64_t, Stream::Type)>& callback);
 
         void onConnectionChange(const std::function<void(int64_t, CallInterface::ConnectionState)>& callback);
 
+        void onSetupMilestone(const std::function<void(int64_t, SetupTimings::Milestone, int64_t)>& callback);
+
         void onSignalingData(const std::function<void(int64_t, const BYTES(bytes::binary)&)>& callback);
 
-        ASYNC_RETURN(void) sendSignalingData(int64_t chatId, const BYTES(bytes::binary) &msgKey);
+        ASYNC_RETURN(void) sendSignalingData(int64_t chatId, const BYTES(rtc::CopyOnWriteBuffer) &msgKey);
 
         ASYNC_RETURN(std::map<int64_t, Stream::Status>) calls();
     };
@@ -0,0 +1,77 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include "compression_dictionary.hpp"
+
+namespace signaling {
+    std::string_view compressionDictionary() {
+        // Most frequent fragments last, deflate reaches them with the shortest distances
+        static constexpr std::string_view dictionary =
+            "a=rtcp-fb:96 goog-remb\r\n"
+            "a=rtcp-fb:96 transport-cc\r\n"
+            "a=rtcp-fb:96 ccm fir\r\n"
+            "a=rtcp-fb:96 nack\r\n"
+            "a=rtcp-fb:96 nack pli\r\n"
+            "a=fmtp:97 apt=96\r\n"
+            "a=rtpmap:97 rtx/90000\r\n"
+            "a=rtpmap:96 VP8/90000\r\n"
+            "a=rtpmap:98 VP9/90000\r\n"
+            "a=rtpmap:100 H264/90000\r\n"
+            "a=fmtp:100 level-asymmetry-allowed=1;packetization-mode=1;profile-level-id=42e01f\r\n"
+            "a=rtpmap:102 AV1/90000\r\n"
+            "a=ssrc-group:FID \r\n"
+            "a=extmap:4 urn:3gpp:video-orientation\r\n"
+            "a=extmap:5 urn:ietf:params:rtp-hdrext:toffset\r\n"
+            "a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+            "a=extmap:2 http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time\r\n"
+            "a=extmap:3 http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01\r\n"
+            "m=video 9 UDP/TLS/RTP/SAVPF 96 97 98 99\r\n"
+            "v=0\r\n"
+            "o=- 2 IN IP4 127.0.0.1\r\n"
+            "s=-\r\n"
+            "t=0 0\r\n"
+            "a=group:BUNDLE 0 1\r\n"
+            "a=extmap-allow-mixed\r\n"
+            "a=msid-semantic: WMS stream\r\n"
+            "m=audio 9 UDP/TLS/RTP/SAVPF 111 63 9 0 8 13 110 126\r\n"
+            "c=IN IP4 0.0.0.0\r\n"
+            "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+            "a=ice-options:trickle\r\n"
+            "a=setup:actpass\r\n"
+            "a=mid:0\r\n"
+            "a=sendrecv\r\n"
+            "a=msid:stream audio\r\n"
+            "a=rtcp-mux\r\n"
+            "a=rtcp-rsize\r\n"
+            "a=rtpmap:111 opus/48000/2\r\n"
+            "a=rtcp-fb:111 transport-cc\r\n"
+            "a=fmtp:111 minptime=10;useinbandfec=1\r\n"
+            "a=ssrc: cname:\r\n"
+            "a=ice-ufrag:\r\n"
+            "a=ice-pwd:\r\n"
+            "a=fingerprint:sha-256 "
+            "{\"@type\":\"answer\",\"sdp\":\""
+            "{\"@type\":\"offer\",\"sdp\":\"v=0\r\n"
+            "o=- "
+            "{\"@type\":\"MediaState\",\"lowBattery\":false,\"muted\":false,\"screencastState\":\"inactive\",\"videoRotati"
+            "on\":0,\"videoState\":\"active\"}"
+            "{\"@type\":\"InitialSetup\",\"fingerprints\":[{\"fingerprint\":\"\",\"hash\":\"sha-256\",\"setup\":\"actpass\"}],\""
+            "pwd\":\"\",\"renomination\":true,\"ufrag\":\"\"}{\"id\":1,\"uri\":\"urn:ietf:params:rtp-hdrext:ssrc-audio-leve"
+            "l\"},{\"id\":2,\"uri\":\"http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time\"},{\"id\":3,\"uri\":\"h"
+            "ttp://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01\"}],\"ssrc\":\"{\"channels\":"
+            "0,\"clockrate\":90000,\"feedbackTypes\":[{\"subtype\":\"\",\"type\":\"goog-remb\"},{\"subtype\":\"\",\"type\":\"tra"
+            "nsport-cc\"},{\"subtype\":\"fir\",\"type\":\"ccm\"},{\"subtype\":\"\",\"type\":\"nack\"},{\"subtype\":\"pli\",\"type\":"
+            "\"nack\"}],\"id\":96,\"name\":\"VP8\",\"parameters\":{}},{\"channels\":0,\"clockrate\":90000,\"feedbackTypes\":["
+            "],\"id\":97,\"name\":\"rtx\",\"parameters\":{\"apt\":\"96\"}},\"ssrcGroups\":[{\"semantics\":\"FID\",\"ssrcs\":[\""
+            "{\"@type\":\"NegotiateChannels\",\"contents\":[{\"payloadTypes\":[{\"channels\":2,\"clockrate\":48000,\"feedb"
+            "ackTypes\":[{\"subtype\":\"\",\"type\":\"transport-cc\"}],\"id\":111,\"name\":\"opus\",\"parameters\":{\"minptime\""
+            ":\"10\",\"useinbandfec\":\"1\"}}],\"rtpExtensions\":[],\"type\":\"audio\"},{\"payloadTypes\":[],\"type\":\"video\""
+            "}],\"exchangeId\":\" typ srflx raddr 0.0.0.0 rport 0 generation 0 ufrag  network-id 1 network-cost "
+            "10\"},"
+            "{\"@type\":\"candidate\",\"mid\":\"0\",\"mline\":0,\"sdp\":\"candidate: 1 udp 2122260223 192.168.1.10  typ ho"
+            "st generation 0 ufrag  network-id 1 network-cost 10\"},{\"sdpString\":\"candidate: 1 udp 2122260223 "
+            "{\"@type\":\"Candidates\",\"candidates\":[{\"sdpString\":\"candidate:";
+        return dictionary;
+    }
+} // signaling
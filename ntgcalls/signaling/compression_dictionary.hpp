@@ -0,0 +1,12 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+#include <string_view>
+
+namespace signaling {
+    // Preset deflate dictionary built from the JSON and SDP fragments exchanged during call setup.
+    // Peers match it by Adler-32, so any edit makes old and new builds fall back to plain gzip
+    std::string_view compressionDictionary();
+} // signaling
@@ -11,13 +11,16 @@
 
 namespace signaling {
     bytes::vector AuthKey::CreateAuthKey(const bytes::const_span firstBytes, const bytes::const_span random, const bytes::const_span primeBytes) {
+        const auto prime = openssl::MontgomeryContext::Cached(primeBytes);
+        if (!ModExpFirst::IsGoodPrime(*prime)) {
+            throw ntgcalls::InvalidParams("Invalid prime");
+        }
         const auto first = openssl::BigNum(firstBytes);
-        const auto prime = openssl::BigNum(primeBytes);
-        if (!ModExpFirst::IsGoodModExpFirst(first, prime)) {
+        if (!ModExpFirst::IsGoodModExpFirst(first, prime->modulus())) {
             throw ntgcalls::InvalidParams("Bad first prime");
         }
         const auto authKey = openssl::BigNum();
-        authKey.setModExp(first, openssl::BigNum(random), prime);
+        authKey.setModExp(first, openssl::BigNum(random), *prime);
         return authKey.getBytes();
     }
 
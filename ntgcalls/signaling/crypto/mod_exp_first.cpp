@@ -12,20 +12,22 @@ namespace signaling {
         if (r.size() != kRandomPowerSize) {
             throw ntgcalls::InvalidParams("Invalid random size");
         }
-        const openssl::BigNum prime(p);
+        const auto prime = openssl::MontgomeryContext::Cached(p);
+        if (!IsGoodPrime(*prime)) {
+            throw ntgcalls::InvalidParams("Invalid prime");
+        }
+        const openssl::BigNum base(g);
+        const auto power = openssl::BigNum();
+        const auto modexp = openssl::BigNum();
         randomPower = bytes::vector(kRandomPowerSize);
         while (true) {
             bytes::set_random(randomPower);
             for (auto i = 0; i != kRandomPowerSize; ++i) {
                 randomPower[i] ^= r[i];
             }
-            const auto modexp = openssl::BigNum();
-            modexp.setModExp(
-                openssl::BigNum(g),
-                openssl::BigNum(randomPower),
-                prime
-            );
-            if (IsGoodModExpFirst(modexp, prime)) {
+            power.setBytes(randomPower);
+            modexp.setModExp(base, power, *prime);
+            if (IsGoodModExpFirst(modexp, prime->modulus())) {
                 this->modexp = modexp.getBytes();
                 break;
             }
@@ -37,6 +39,10 @@ namespace signaling {
         modexp.clear();
     }
 
+    bool ModExpFirst::IsGoodPrime(const openssl::MontgomeryContext& prime) {
+        return !prime.failed() && prime.modulus().bitsSize() == kPrimeBitsSize && prime.isSafePrime();
+    }
+
     bool ModExpFirst::IsGoodModExpFirst(const openssl::BigNum& modexp, const openssl::BigNum& prime) {
         const auto diff = openssl::BigNum();
         diff.setSub(prime, modexp);
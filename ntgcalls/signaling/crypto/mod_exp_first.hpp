@@ -8,9 +8,12 @@
 namespace signaling {
     class ModExpFirst {
         static constexpr size_t kRandomPowerSize = 256;
+        static constexpr uint32_t kPrimeBitsSize = 2048;
     public:
         bytes::vector randomPower, modexp;
 
+        static bool IsGoodPrime(const openssl::MontgomeryContext &prime);
+
         static bool IsGoodModExpFirst(const openssl::BigNum &modexp, const openssl::BigNum &prime);
 
         ModExpFirst(int32_t g, bytes::const_span p, bytes::const_span r);
@@ -11,28 +11,27 @@
 #include <rtc_base/time_utils.h>
 
 #include "ntgcalls/signaling/messages/message.hpp"
-#include "wrtc/utils/encryption.hpp"
 
 namespace signaling {
     SignalingEncryption::SignalingEncryption(EncryptionKey key): _key(std::move(key)) {}
 
     SignalingEncryption::~SignalingEncryption() {
         counter = 0;
-        largestIncomingCounters.clear();
+        incomingCountersWindow = 0;
     }
 
     bytes::binary SignalingEncryption::encryptPrepared(const rtc::CopyOnWriteBuffer &buffer) const {
         bytes::binary encrypted(16 + buffer.size());
         const auto x = (_key.isOutgoing ? 0 : 8) + 128;
         const auto key = _key.value->data();
-        const auto msgKeyLarge = openssl::Sha256::Concat(
+        const auto msgKeyLarge = encryptDigest.concat(
             bytes::memory_span(key + 88 + x, 32),
             bytes::memory_span(buffer.data(), buffer.size())
         );
         const auto msgKey = encrypted.data();
         memcpy(msgKey, msgKeyLarge.data() + 8, 16);
-        auto aesKeyIv = openssl::Aes::PrepareKeyIv(key, msgKey, x);
-        openssl::Aes::ProcessCtr(
+        const auto aesKeyIv = openssl::Aes::PrepareKeyIv(encryptDigest, key, msgKey, x);
+        encryptCipher.processCtr(
             bytes::memory_span(buffer.data(), buffer.size()),
             encrypted.data() + 16,
             aesKeyIv
@@ -69,65 +68,83 @@ namespace signaling {
     }
 
     bool SignalingEncryption::registerIncomingCounter(const uint32_t incomingCounter) {
-        auto &list = largestIncomingCounters;
-        const auto position = std::ranges::lower_bound(list, incomingCounter);
-        const auto largest = list.empty() ? 0 : list.back();
-        if (position != list.end() && *position == incomingCounter) {
+        static_assert(kKeepIncomingCountersCount <= sizeof(incomingCountersWindow) * 8);
+        if (incomingCounter > largestIncomingCounter) {
+            const auto shift = incomingCounter - largestIncomingCounter;
+            incomingCountersWindow = shift < kKeepIncomingCountersCount ? incomingCountersWindow << shift : 0;
+            incomingCountersWindow |= 1;
+            largestIncomingCounter = incomingCounter;
+            return true;
+        }
+        const auto offset = largestIncomingCounter - incomingCounter;
+        if (offset >= kKeepIncomingCountersCount) {
             return false;
         }
-        if (incomingCounter + kKeepIncomingCountersCount <= largest) {
+        const auto bit = static_cast<uint64_t>(1) << offset;
+        if (incomingCountersWindow & bit) {
             return false;
         }
-        const auto eraseTill = std::ranges::find_if(list, [&](const uint32_t counter) {
-            return counter + kKeepIncomingCountersCount > incomingCounter;
-        });
-        const auto eraseCount = eraseTill - list.begin();
-        const auto positionIndex = position - list.begin() - eraseCount;
-        list.erase(list.begin(), eraseTill);
-
-        assert(positionIndex >= 0 && positionIndex <= list.size());
-        list.insert(list.begin() + positionIndex, incomingCounter);
+        incomingCountersWindow |= bit;
         return true;
     }
 
     void SignalingEncryption::ackMyMessage(const uint32_t seq) {
         auto type = static_cast<uint8_t>(0);
         auto &list = myNotYetAckedMessages;
-        for (auto i = list.begin(), e = list.end(); i != e; ++i) {
-            assert(i->data.size() >= 5);
-            if (ReadSeq(i->data.cdata()) == seq) {
-                type = static_cast<uint8_t>(i->data.cdata()[4]);
-                list.erase(i);
-                break;
+        if (const auto ackedCounter = CounterFromSeq(seq); ackedCounter >= notYetAckedFirstCounter && ackedCounter - notYetAckedFirstCounter < list.size()) {
+            if (auto &entry = list[ackedCounter - notYetAckedFirstCounter]; entry && ReadSeq(entry->data.cdata()) == seq) {
+                assert(entry->data.size() >= 5);
+                type = static_cast<uint8_t>(entry->data.cdata()[4]);
+                entry.reset();
+                notYetAckedCount--;
+                while (!list.empty() && !list.front()) {
+                    list.pop_front();
+                    notYetAckedFirstCounter++;
+                }
             }
         }
         RTC_LOG(LS_INFO) << (type ? "Got ACK:type" + std::to_string(type) + "#" : "Repeated ACK#") << CounterFromSeq(seq);
     }
 
     void SignalingEncryption::sendAckPostponed(const uint32_t incomingSeq) {
-        auto &list = acksToSendSeqs;
-        if (const auto already = std::ranges::find(list, incomingSeq); already == list.end()) {
-            list.push_back(incomingSeq);
+        if (acksToSendLookup.insert(incomingSeq).second) {
+            acksToSendSeqs.push_back(incomingSeq);
         }
     }
 
     bool SignalingEncryption::registerSentAck(const uint32_t counter, const bool firstInPacket) {
         auto &list = acksSentCounters;
-        const auto position = std::ranges::lower_bound(list, counter);
-        const auto already = position != list.end() && *position == counter;
-        const auto was = list;
-        if (firstInPacket) {
-            list.erase(list.begin(), position);
-            if (!already) {
-                list.insert(list.begin(), counter);
+        const auto word = counter / 64;
+        const auto bit = static_cast<uint64_t>(1) << counter % 64;
+        if (list.empty() || word >= acksSentFirstWord + kMaxAcksSentWords) {
+            list.clear();
+            acksSentFirstWord = word;
+        }
+        if (firstInPacket && word >= acksSentFirstWord) {
+            // The peer resends starting from its oldest unacknowledged message, anything below it is settled
+            list.erase(list.begin(), list.begin() + std::min<size_t>(word - acksSentFirstWord, list.size()));
+            acksSentFirstWord = word;
+            if (!list.empty()) {
+                list.front() &= ~(bit - 1);
+            }
+        }
+        if (word < acksSentFirstWord) {
+            if (acksSentFirstWord - word + list.size() > kMaxAcksSentWords) {
+                return true;
             }
-        } else if (!already) {
-            list.insert(position, counter);
+            list.insert(list.begin(), acksSentFirstWord - word, 0);
+            acksSentFirstWord = word;
+        }
+        if (word - acksSentFirstWord >= list.size()) {
+            list.resize(word - acksSentFirstWord + 1, 0);
         }
+        auto &slot = list[word - acksSentFirstWord];
+        const auto already = (slot & bit) != 0;
+        slot |= bit;
         return !already;
     }
 
-    std::vector<rtc::CopyOnWriteBuffer> SignalingEncryption::processRawPacket(const rtc::Buffer &fullBuffer, uint32_t packetSeq) {
+    std::vector<rtc::CopyOnWriteBuffer> SignalingEncryption::processRawPacket(const rtc::CopyOnWriteBuffer &fullBuffer, uint32_t packetSeq) {
         if (fullBuffer.size() < 4) {
             RTC_LOG(LS_ERROR) << "Bad incoming data size";
             return {};
@@ -164,7 +181,7 @@ namespace signaling {
                 reader.Consume(1);
             } else if (type == kCustomId) {
                 reader.Consume(1);
-                if (auto message = Message::deserializeRaw(reader)) {
+                if (auto message = Message::deserializeRaw(reader, fullBuffer)) {
                     const auto messageRequiresAck = (currentSeq & kMessageRequiresAckSeqBit) != 0;
                     const auto skipMessage = messageRequiresAck
                         ? !registerSentAck(currentCounter, firstMessageRequiringAck)
@@ -218,7 +235,7 @@ namespace signaling {
     }
 
     std::optional<uint32_t> SignalingEncryption::computeNextSeq(const bool messageRequiresAck) {
-        if (messageRequiresAck && myNotYetAckedMessages.size() >= kNotAckedMessagesLimit) {
+        if (messageRequiresAck && notYetAckedCount >= kNotAckedMessagesLimit) {
             RTC_LOG(LS_ERROR) << "Too many not ACKed messages.";
             return std::nullopt;
         }
@@ -260,7 +277,11 @@ namespace signaling {
             return;
         }
         const auto now = rtc::TimeMillis();
-        for (auto &[data, lastSent] : myNotYetAckedMessages) {
+        for (auto &entry : myNotYetAckedMessages) {
+            if (!entry) {
+                continue;
+            }
+            auto &[data, lastSent] = *entry;
             const auto sent = lastSent;
             const auto when = sent ? sent + minDelayBeforeMessageResend : 0;
             assert(data.size() >= 5);
@@ -290,21 +311,21 @@ namespace signaling {
     }
 
     void SignalingEncryption::appendAcksToSend(rtc::CopyOnWriteBuffer &buffer) {
-        auto i = acksToSendSeqs.begin();
-        while (i != acksToSendSeqs.end() && enoughSpaceInPacket(buffer, kAckSerializedSize)) {
-            RTC_LOG(LS_INFO) << "Add ACK#" << CounterFromSeq(*i);
-            AppendSeq(buffer, *i);
+        while (!acksToSendSeqs.empty() && enoughSpaceInPacket(buffer, kAckSerializedSize)) {
+            const auto seq = acksToSendSeqs.front();
+            RTC_LOG(LS_INFO) << "Add ACK#" << CounterFromSeq(seq);
+            AppendSeq(buffer, seq);
             buffer.AppendData(&kAckId, 1);
-            ++i;
+            acksToSendSeqs.pop_front();
+            acksToSendLookup.erase(seq);
         }
-        acksToSendSeqs.erase(acksToSendSeqs.begin(), i);
         for (const auto seq : acksToSendSeqs) {
             RTC_LOG(LS_INFO) << "Skip ACK#" << CounterFromSeq(seq) << " (no space, length: " << kAckSerializedSize << ", already: " << buffer.size() << ")";
         }
     }
 
     bool SignalingEncryption::haveMessages() const {
-        return !myNotYetAckedMessages.empty() || !acksToSendSeqs.empty();
+        return notYetAckedCount || !acksToSendSeqs.empty();
     }
 
     std::optional<bytes::binary> SignalingEncryption::prepareForSendingMessageInternal(rtc::CopyOnWriteBuffer &serialized, uint32_t seq) {
@@ -314,19 +335,26 @@ namespace signaling {
         }
         const auto notYetAckedCopy = serialized;
         const auto type = static_cast<uint8_t>(serialized.cdata()[4]);
-        const auto sendEnqueued = !myNotYetAckedMessages.empty();
+        const auto sendEnqueued = notYetAckedCount != 0;
         if (sendEnqueued) {
             RTC_LOG(LS_INFO) << "Enqueue SEND:type" << type << "#" << CounterFromSeq(seq);
         } else {
             RTC_LOG(LS_INFO) << "Add SEND:type" << type << "#" << CounterFromSeq(seq);
             appendMessages(serialized);
         }
-        myNotYetAckedMessages.push_back({notYetAckedCopy, rtc::TimeMillis()});
+        if (myNotYetAckedMessages.empty()) {
+            notYetAckedFirstCounter = CounterFromSeq(seq);
+        }
+        myNotYetAckedMessages.resize(CounterFromSeq(seq) - notYetAckedFirstCounter);
+        myNotYetAckedMessages.emplace_back(MessageForResend{notYetAckedCopy, rtc::TimeMillis()});
+        notYetAckedCount++;
         if (!sendEnqueued) {
             return encryptPrepared(serialized);
         }
-        for (auto &[data, lastSent] : myNotYetAckedMessages) {
-            lastSent = 0;
+        for (auto &entry : myNotYetAckedMessages) {
+            if (entry) {
+                entry->lastSent = 0;
+            }
         }
         return prepareForSendingService(0);
     }
@@ -361,15 +389,16 @@ namespace signaling {
         const auto encryptedData = msgKey + 16;
         const auto dataSize = buffer.size() - 16;
 
-        auto aesKeyIv = openssl::Aes::PrepareKeyIv(key, msgKey, x);
-        auto decryptionBuffer = rtc::Buffer(dataSize);
-        openssl::Aes::ProcessCtr(
+        const auto aesKeyIv = openssl::Aes::PrepareKeyIv(decryptDigest, key, msgKey, x);
+        // Every message handed out below is a slice of this buffer, so the plaintext is written exactly once
+        auto decryptionBuffer = rtc::CopyOnWriteBuffer(dataSize);
+        decryptCipher.processCtr(
             bytes::memory_span(encryptedData, dataSize),
-            decryptionBuffer.data(),
+            decryptionBuffer.MutableData(),
             aesKeyIv
         );
 
-        if (const auto msgKeyLarge = openssl::Sha256::Concat(
+        if (const auto msgKeyLarge = decryptDigest.concat(
             bytes::memory_span(key + 88 + x, 32),
             bytes::memory_span(decryptionBuffer.data(), decryptionBuffer.size())
         ); ConstTimeIsDifferent(msgKeyLarge.data() + 8, msgKey, 16)) {
@@ -377,7 +406,7 @@ namespace signaling {
             return {};
         }
 
-        const auto incomingSeq = ReadSeq(decryptionBuffer.data());
+        const auto incomingSeq = ReadSeq(decryptionBuffer.cdata());
         if (const auto incomingCounter = CounterFromSeq(incomingSeq); !registerIncomingCounter(incomingCounter)) {
             RTC_LOG(LS_ERROR) << "Already handled packet received." << std::to_string(incomingCounter);
             return {};
@@ -386,9 +415,7 @@ namespace signaling {
         if (isRaw) {
             return processRawPacket(decryptionBuffer, incomingSeq);
         }
-        rtc::CopyOnWriteBuffer resultBuffer;
-        resultBuffer.AppendData(decryptionBuffer.data() + 4, decryptionBuffer.size() - 4);
-        return {resultBuffer};
+        return {decryptionBuffer.Slice(4, dataSize - 4)};
     }
 
     void SignalingEncryption::onServiceMessage(const std::function<void(int delayMs, int cause)> &requestSendService) {
@@ -3,13 +3,16 @@
 //
 #pragma once
 #include <cstdint>
+#include <deque>
 #include <optional>
+#include <unordered_set>
 #include <rtc_base/byte_buffer.h>
 #include <rtc_base/copy_on_write_buffer.h>
 
 
 #include "auth_key.hpp"
 #include "wrtc/utils/binary.hpp"
+#include "wrtc/utils/encryption.hpp"
 #include "wrtc/utils/syncronized_callback.hpp"
 
 namespace signaling {
@@ -22,10 +25,21 @@ namespace signaling {
 
         uint64_t counter = 0;
         EncryptionKey _key;
-        std::vector<uint32_t> largestIncomingCounters;
-        std::vector<MessageForResend> myNotYetAckedMessages;
-        std::vector<uint32_t> acksSentCounters;
-        std::vector<uint32_t> acksToSendSeqs;
+        // One pair per direction, encrypt and decrypt may run on different threads
+        openssl::Sha256::Context encryptDigest, decryptDigest;
+        openssl::Aes::Context encryptCipher, decryptCipher;
+        // Bit i is set when counter largestIncomingCounter - i was already received
+        uint32_t largestIncomingCounter = 0;
+        uint64_t incomingCountersWindow = 0;
+        // Indexed by counter - notYetAckedFirstCounter, counters used by service packets are left empty
+        std::deque<std::optional<MessageForResend>> myNotYetAckedMessages;
+        uint32_t notYetAckedFirstCounter = 0;
+        size_t notYetAckedCount = 0;
+        // One bit per counter, the first word covers counters from acksSentFirstWord * 64
+        std::deque<uint64_t> acksSentCounters;
+        uint32_t acksSentFirstWord = 0;
+        std::deque<uint32_t> acksToSendSeqs;
+        std::unordered_set<uint32_t> acksToSendLookup;
         bool sendAcksTimerActive, resendTimerActive;
 
         static constexpr auto kSingleMessagePacketSeqBit = static_cast<uint32_t>(1) << 31;
@@ -36,6 +50,7 @@ namespace signaling {
         static constexpr auto kMaxIncomingPacketSize = 128 * 1024;
         static constexpr auto kAckSerializedSize = sizeof(uint32_t) + sizeof(uint8_t);
         static constexpr auto kNotAckedMessagesLimit = 64 * 1024;
+        static constexpr auto kMaxAcksSentWords = 4 * kNotAckedMessagesLimit / 64;
 
         static constexpr auto minDelayBeforeMessageResend = 3000;
         static constexpr auto maxDelayBeforeAckResend = 5000;
@@ -69,7 +84,7 @@ namespace signaling {
 
         bool registerSentAck(uint32_t counter, bool firstInPacket);
 
-        std::vector<rtc::CopyOnWriteBuffer> processRawPacket(const rtc::Buffer &fullBuffer,uint32_t packetSeq);
+        std::vector<rtc::CopyOnWriteBuffer> processRawPacket(const rtc::CopyOnWriteBuffer &fullBuffer,uint32_t packetSeq);
 
         std::optional<uint32_t> computeNextSeq(bool messageRequiresAck);
 
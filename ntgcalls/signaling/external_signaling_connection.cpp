@@ -11,16 +11,26 @@ namespace signaling {
         const EncryptionKey &key,
         const DataEmitter& onEmitData,
         const DataReceiver& onSignalData
-    ): SignalingInterface(networkThread, signalingThread, key, onEmitData, onSignalData) {}
+    ): SignalingInterface(networkThread, signalingThread, key, onEmitData, onSignalData),
+        signalingSafety(webrtc::PendingTaskSafetyFlag::CreateDetached()) {}
+
+    ExternalSignalingConnection::~ExternalSignalingConnection() {
+        signalingThread->BlockingCall([&] {
+            signalingSafety->SetNotAlive();
+        });
+    }
 
     void ExternalSignalingConnection::send(const bytes::binary& data) {
-        onEmitData(preSendData(data, true));
+        // Encryption state is only touched from the signaling thread, as on the SCTP path
+        signalingThread->PostTask(webrtc::SafeTask(signalingSafety, [this, data] {
+            onEmitData(preSendData(data, true));
+        }));
     }
 
-    void ExternalSignalingConnection::receive(const bytes::binary& data) const {
-        signalingThread->PostTask([this, data] {
+    void ExternalSignalingConnection::receive(const rtc::CopyOnWriteBuffer& data) const {
+        signalingThread->PostTask(webrtc::SafeTask(signalingSafety, [this, data] {
             onSignalData(preReadData(data, true));
-        });
+        }));
     }
 
     bool ExternalSignalingConnection::supportsCompression() const {
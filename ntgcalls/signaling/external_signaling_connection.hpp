@@ -3,12 +3,15 @@
 //
 
 #pragma once
+#include <api/task_queue/pending_task_safety_flag.h>
 #include <rtc_base/third_party/sigslot/sigslot.h>
 
 #include "signaling_interface.hpp"
 
 namespace signaling {
     class ExternalSignalingConnection final : public sigslot::has_slots<>, public SignalingInterface {
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> signalingSafety;
+
     public:
         ExternalSignalingConnection(
             rtc::Thread* networkThread,
@@ -18,9 +21,11 @@ namespace signaling {
             const DataReceiver& onSignalData
         );
 
+        ~ExternalSignalingConnection() override;
+
         void send(const bytes::binary& data) override;
 
-        void receive(const bytes::binary& data) const override;
+        void receive(const rtc::CopyOnWriteBuffer& data) const override;
 
     protected:
         [[nodiscard]] bool supportsCompression() const override;
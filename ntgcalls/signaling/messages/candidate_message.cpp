@@ -15,11 +15,14 @@ namespace signaling {
     }
 
     std::unique_ptr<CandidateMessage> CandidateMessage::deserialize(const bytes::binary& data) {
-        json j = json::parse(data.begin(), data.end());
-        auto message = std::make_unique<CandidateMessage>();
-        message->mid = j["mid"];
-        message->mLine = j["mline"];
-        message->sdp = j["sdp"];
-        return std::move(message);
+        return std::make_unique<CandidateMessage>(deserialize(json::parse(data.begin(), data.end())));
+    }
+
+    CandidateMessage CandidateMessage::deserialize(const json& j) {
+        CandidateMessage message;
+        message.mid = j.at("mid");
+        message.mLine = j.at("mline");
+        message.sdp = j.at("sdp");
+        return message;
     }
 } // signaling
\ No newline at end of file
@@ -16,6 +16,8 @@ namespace signaling {
         [[nodiscard]] bytes::binary serialize() const override;
 
         static std::unique_ptr<CandidateMessage> deserialize(const bytes::binary& data);
+
+        static CandidateMessage deserialize(const json& j);
     };
 
 } // signaling
@@ -20,11 +20,16 @@ namespace signaling {
     }
 
     std::unique_ptr<CandidatesMessage> CandidatesMessage::deserialize(const bytes::binary &data) {
-        json j = json::parse(data.begin(), data.end());
-        auto message = std::make_unique<CandidatesMessage>();
-        for (const auto& iceCandidate : j["candidates"]) {
-            message->iceCandidates.push_back(IceCandidate{iceCandidate["sdpString"]});
+        return std::make_unique<CandidatesMessage>(deserialize(json::parse(data.begin(), data.end())));
+    }
+
+    CandidatesMessage CandidatesMessage::deserialize(const json& j) {
+        CandidatesMessage message;
+        const auto& candidates = j.at("candidates");
+        message.iceCandidates.reserve(candidates.size());
+        for (const auto& iceCandidate : candidates) {
+            message.iceCandidates.push_back(IceCandidate{iceCandidate.at("sdpString")});
         }
-        return std::move(message);
+        return message;
     }
 } // signaling
\ No newline at end of file
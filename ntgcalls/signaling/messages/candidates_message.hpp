@@ -20,6 +20,8 @@ namespace signaling {
         [[nodiscard]] bytes::binary serialize() const override;
 
         static std::unique_ptr<CandidatesMessage> deserialize(const bytes::binary& data);
+
+        static CandidatesMessage deserialize(const json& j);
     };
 
 } // signaling
\ No newline at end of file
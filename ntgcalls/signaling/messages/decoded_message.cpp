@@ -0,0 +1,41 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#include "decoded_message.hpp"
+
+#include "ntgcalls/exceptions.hpp"
+
+namespace signaling {
+    DecodedMessage decode(const rtc::ArrayView<const uint8_t> data) {
+        if (data.empty()) {
+            throw ntgcalls::InvalidParams("Empty data");
+        }
+        try {
+            const auto j = json::parse(data.begin(), data.end());
+            const auto typeIt = j.find("@type");
+            if (typeIt == j.end() || !typeIt->is_string()) {
+                return std::monostate{};
+            }
+            const auto& type = typeIt->get_ref<const std::string&>();
+            if (type == "candidate") {
+                return CandidateMessage::deserialize(j);
+            }
+            if (type == "offer" || type == "answer") {
+                return RtcDescriptionMessage::deserialize(j);
+            }
+            if (type == "InitialSetup") {
+                return InitialSetupMessage::deserialize(j);
+            }
+            if (type == "Candidates") {
+                return CandidatesMessage::deserialize(j);
+            }
+            if (type == "NegotiateChannels") {
+                return NegotiateChannelsMessage::deserialize(j);
+            }
+            return std::monostate{};
+        } catch (json::exception& e) {
+            throw ntgcalls::InvalidParams("Signaling: " + std::string(e.what()));
+        }
+    }
+} // signaling
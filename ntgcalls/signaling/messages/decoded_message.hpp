@@ -0,0 +1,27 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+#include <variant>
+#include <api/array_view.h>
+
+#include "candidate_message.hpp"
+#include "candidates_message.hpp"
+#include "initial_setup_message.hpp"
+#include "negotiate_channels_message.hpp"
+#include "rtc_description_message.hpp"
+
+namespace signaling {
+    using DecodedMessage = std::variant<
+        std::monostate,
+        CandidateMessage,
+        RtcDescriptionMessage,
+        InitialSetupMessage,
+        CandidatesMessage,
+        NegotiateChannelsMessage
+    >;
+
+    // Parses the buffer once and dispatches on "@type", std::monostate for unknown types
+    DecodedMessage decode(rtc::ArrayView<const uint8_t> data);
+} // signaling
@@ -25,18 +25,21 @@ namespace signaling {
     }
 
     std::unique_ptr<InitialSetupMessage> InitialSetupMessage::deserialize(const bytes::binary& data) {
-        json j = json::parse(data.begin(), data.end());
-        auto message = std::make_unique<InitialSetupMessage>();
-        message->ufrag = j["ufrag"];
-        message->pwd = j["pwd"];
-        message->supportsRenomination = j["renomination"];
-        for (const auto& fingerprint : j["fingerprints"]) {
-            message->fingerprints.push_back({
-                fingerprint["hash"],
-                fingerprint["setup"],
-                fingerprint["fingerprint"],
+        return std::make_unique<InitialSetupMessage>(deserialize(json::parse(data.begin(), data.end())));
+    }
+
+    InitialSetupMessage InitialSetupMessage::deserialize(const json& j) {
+        InitialSetupMessage message;
+        message.ufrag = j.at("ufrag");
+        message.pwd = j.at("pwd");
+        message.supportsRenomination = j.at("renomination");
+        for (const auto& fingerprint : j.at("fingerprints")) {
+            message.fingerprints.push_back({
+                fingerprint.at("hash"),
+                fingerprint.at("setup"),
+                fingerprint.at("fingerprint"),
             });
         }
-        return std::move(message);
+        return message;
     }
 } // signaling
\ No newline at end of file
@@ -26,6 +26,8 @@ namespace signaling {
         [[nodiscard]] bytes::binary serialize() const override;
 
         static std::unique_ptr<InitialSetupMessage> deserialize(const bytes::binary& data);
+
+        static InitialSetupMessage deserialize(const json& j);
     };
 
 } // signaling
\ No newline at end of file
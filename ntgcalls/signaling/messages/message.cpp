@@ -31,7 +31,7 @@ namespace signaling {
         return Type::Unknown;
     }
 
-    std::optional<rtc::CopyOnWriteBuffer> Message::deserializeRaw(rtc::ByteBufferReader &reader) {
+    std::optional<rtc::CopyOnWriteBuffer> Message::deserializeRaw(rtc::ByteBufferReader &reader, const rtc::CopyOnWriteBuffer &source) {
         if (!reader.Length()) {
             return std::nullopt;
         }
@@ -39,15 +39,12 @@ namespace signaling {
         if (!reader.ReadUInt32(&length)) {
             return std::nullopt;
         }
-        if (length > 1024 * 1024) {
+        if (length > 1024 * 1024 || length > reader.Length()) {
             return std::nullopt;
         }
-        rtc::CopyOnWriteBuffer result;
-        result.SetSize(length);
-        if (!reader.ReadBytes(rtc::MakeArrayView(result.MutableData(), result.size()))) {
-            return std::nullopt;
-        }
-        return result;
+        const auto offset = static_cast<size_t>(reinterpret_cast<const uint8_t*>(reader.Data()) - source.cdata());
+        reader.Consume(length);
+        return source.Slice(offset, length);
     }
 
     uint32_t Message::stringToUInt32(std::string const &string) {
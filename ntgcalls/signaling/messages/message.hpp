@@ -29,7 +29,8 @@ namespace signaling {
 
         static Type type(const bytes::binary& data);
 
-        static std::optional<rtc::CopyOnWriteBuffer> deserializeRaw(rtc::ByteBufferReader &reader);
+        // Returns a slice of source, which must be the buffer the reader is walking
+        static std::optional<rtc::CopyOnWriteBuffer> deserializeRaw(rtc::ByteBufferReader &reader, const rtc::CopyOnWriteBuffer &source);
 
         static uint32_t stringToUInt32(std::string const &string);
     };
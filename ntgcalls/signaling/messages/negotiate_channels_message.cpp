@@ -209,27 +209,32 @@ namespace signaling {
     }
 
     std::unique_ptr<NegotiateChannelsMessage> NegotiateChannelsMessage::deserialize(const bytes::binary &data) {
-        json j = json::parse(data.begin(), data.end());
-        auto message = std::make_unique<NegotiateChannelsMessage>();
+        return std::make_unique<NegotiateChannelsMessage>(deserialize(json::parse(data.begin(), data.end())));
+    }
+
+    NegotiateChannelsMessage NegotiateChannelsMessage::deserialize(const json& j) {
+        NegotiateChannelsMessage message;
         if (!j.contains("exchangeId")) {
             throw ntgcalls::InvalidParams("Signaling: exchangeId must be present");
         }
-        if (const auto exchangeId = j["exchangeId"]; exchangeId.is_string()) {
-            message->exchangeId = stringToUInt32(exchangeId);
+        if (const auto& exchangeId = j["exchangeId"]; exchangeId.is_string()) {
+            message.exchangeId = stringToUInt32(exchangeId);
         } else if (exchangeId.is_number()) {
-            message->exchangeId = static_cast<uint32_t>(exchangeId);
+            message.exchangeId = static_cast<uint32_t>(exchangeId);
         } else {
             throw ntgcalls::InvalidParams("Signaling: exchangeId must be a string or a number");
         }
         if (!j.contains("contents")) {
             throw ntgcalls::InvalidParams("Signaling: contents must be present");
         }
-        for (const auto &content : j["contents"].items()) {
+        const auto& contents = j["contents"];
+        message.contents.reserve(contents.size());
+        for (const auto &content : contents.items()) {
             if (!content.value().is_object()) {
                 throw ntgcalls::InvalidParams("Signaling: contents items must be objects");
             }
-            message->contents.push_back(deserializeContent(content.value()));
+            message.contents.push_back(deserializeContent(content.value()));
         }
-        return std::move(message);
+        return message;
     }
 } // signaling
\ No newline at end of file
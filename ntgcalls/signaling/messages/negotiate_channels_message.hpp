@@ -30,5 +30,7 @@ namespace signaling {
         [[nodiscard]] bytes::binary serialize() const override;
 
         static std::unique_ptr<NegotiateChannelsMessage> deserialize(const bytes::binary& data);
+
+        static NegotiateChannelsMessage deserialize(const json& j);
     };
 } // signaling
\ No newline at end of file
@@ -15,14 +15,18 @@ namespace signaling {
     }
 
     std::unique_ptr<RtcDescriptionMessage> RtcDescriptionMessage::deserialize(const bytes::binary& data) {
-        json j = json::parse(data.begin(), data.end());
-        auto message = std::make_unique<RtcDescriptionMessage>();
-        if (j["@type"] != "offer" && j["@type"] != "answer") {
-            RTC_LOG(LS_ERROR) << "Invalid sdp type: " << j["@type"];
+        return std::make_unique<RtcDescriptionMessage>(deserialize(json::parse(data.begin(), data.end())));
+    }
+
+    RtcDescriptionMessage RtcDescriptionMessage::deserialize(const json& j) {
+        RtcDescriptionMessage message;
+        const auto& type = j.at("@type");
+        if (type != "offer" && type != "answer") {
+            RTC_LOG(LS_ERROR) << "Invalid sdp type: " << type;
             throw ntgcalls::InvalidParams("Invalid sdp type");
         }
-        message->type = j["@type"] == "offer" ? wrtc::Description::SdpType::Offer : wrtc::Description::SdpType::Answer;
-        message->sdp = j["sdp"];
-        return std::move(message);
+        message.type = type == "offer" ? wrtc::Description::SdpType::Offer : wrtc::Description::SdpType::Answer;
+        message.sdp = j.at("sdp");
+        return message;
     }
 } // signaling
\ No newline at end of file
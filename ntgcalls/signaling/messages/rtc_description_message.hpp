@@ -18,6 +18,8 @@ public:
 
     static std::unique_ptr<RtcDescriptionMessage> deserialize(const bytes::binary& data);
 
+    static RtcDescriptionMessage deserialize(const json& j);
+
 };
 
 } // signaling
@@ -4,11 +4,16 @@
 
 #include "signaling_interface.hpp"
 
+#include <algorithm>
 #include <utility>
 
+#include "compression_dictionary.hpp"
 #include "ntgcalls/exceptions.hpp"
 
 namespace signaling {
+    std::atomic_int SignalingInterface::_compressionLevel = bytes::GZip::DefaultLevel;
+    std::atomic_bool SignalingInterface::_compressionDictionary = true;
+
     SignalingInterface::~SignalingInterface() {
         signalingEncryption = nullptr;
     }
@@ -20,6 +25,10 @@ namespace signaling {
         DataEmitter onEmitData,
         DataReceiver onSignalData
     ): onSignalData(std::move(onSignalData)), onEmitData(std::move(onEmitData)), networkThread(networkThread), signalingThread(signalingThread) {
+        compressor = std::make_unique<bytes::GZip>(
+            _compressionLevel,
+            _compressionDictionary ? compressionDictionary() : std::string_view()
+        );
         signalingEncryption = std::make_shared<SignalingEncryption>(key);
         signalingEncryptionWeak = signalingEncryption;
         signalingEncryption->onServiceMessage([this](const int delayMs, int cause) {
@@ -47,36 +56,36 @@ namespace signaling {
         });
     }
 
-    std::vector<bytes::binary> SignalingInterface::preReadData(const bytes::binary &data, const bool isRaw) const {
+    std::vector<rtc::CopyOnWriteBuffer> SignalingInterface::preReadData(const rtc::CopyOnWriteBuffer &data, const bool isRaw) const {
         RTC_LOG(LS_VERBOSE) << "Decrypting packets";
-        const auto raw = signalingEncryption->decrypt(rtc::CopyOnWriteBuffer(data.data(), data.size()), isRaw);
-        if (raw.empty()) {
+        auto packets = signalingEncryption->decrypt(data, isRaw);
+        if (packets.empty()) {
             return {};
         }
         RTC_LOG(LS_VERBOSE) << "Packets decrypted";
-        std::vector<bytes::binary> packets;
-        for (auto& packet : raw) {
-            auto decryptedData = bytes::binary(packet.data(), packet.data() + packet.size());
-            if (bytes::GZip::isGzip(decryptedData)) {
-                RTC_LOG(LS_VERBOSE) << "Decompressing packet";
-                if (auto unzipped = bytes::GZip::unzip(decryptedData, 2 * 1024 * 1024); unzipped.has_value()) {
-                    packets.push_back(unzipped.value());
-                    continue;
-                }
-                RTC_LOG(LS_ERROR) << "Failed to decompress packet";
+        for (auto packet = packets.begin(); packet != packets.end();) {
+            if (!bytes::GZip::isGzip(*packet)) {
+                ++packet;
+                continue;
+            }
+            RTC_LOG(LS_VERBOSE) << "Decompressing packet";
+            if (auto unzipped = compressor->decompress(*packet, 2 * 1024 * 1024); unzipped.has_value()) {
+                *packet++ = std::move(*unzipped);
                 continue;
             }
-            packets.push_back(decryptedData);
+            RTC_LOG(LS_ERROR) << "Failed to decompress packet";
+            packet = packets.erase(packet);
         }
         return packets;
     }
 
     bytes::binary SignalingInterface::preSendData(const bytes::binary &data, const bool isRaw) const {
-        auto packetData = data;
+        bytes::binary compressed;
         if (supportsCompression()) {
-            RTC_LOG(LS_VERBOSE) << "Compressing packet";
-            packetData = std::move(bytes::GZip::zip(packetData));
+            RTC_LOG(LS_VERBOSE) << "Compressing packet" << (compressor->dictionaryNegotiated() ? " with dictionary" : "");
+            compressed = compressor->compress(data);
         }
+        const auto& packetData = supportsCompression() ? compressed : data;
         RTC_LOG(LS_VERBOSE) << "Encrypting packet";
         const auto packet = signalingEncryption->encrypt(rtc::CopyOnWriteBuffer(packetData.data(), packetData.size()), isRaw);
         if (!packet.has_value()) {
@@ -86,4 +95,9 @@ namespace signaling {
         RTC_LOG(LS_VERBOSE) << "Packet encrypted";
         return *packet;
     }
+
+    void SignalingInterface::SetCompression(const int level, const bool useDictionary) {
+        _compressionLevel = std::clamp(level, 0, 9);
+        _compressionDictionary = useDictionary;
+    }
 } // signaling
\ No newline at end of file
@@ -8,10 +8,11 @@
 
 #include "crypto/signaling_encryption.hpp"
 #include "crypto/auth_key.hpp"
+#include "wrtc/utils/g_zip.hpp"
 
 namespace signaling {
     using DataEmitter = std::function<void(const bytes::binary&)>;
-    using DataReceiver = std::function<void(const std::vector<bytes::binary>&)>;
+    using DataReceiver = std::function<void(const std::vector<rtc::CopyOnWriteBuffer>&)>;
 
     class SignalingInterface {
     public:
@@ -27,20 +28,26 @@ namespace signaling {
 
         virtual void send(const bytes::binary& data) = 0;
 
-        virtual void receive(const bytes::binary& data) const = 0;
+        virtual void receive(const rtc::CopyOnWriteBuffer& data) const = 0;
+
+        static void SetCompression(int level, bool useDictionary);
 
     protected:
         DataReceiver onSignalData;
         DataEmitter onEmitData;
         rtc::Thread *networkThread, *signalingThread;
 
-        [[nodiscard]] std::vector<bytes::binary> preReadData(const bytes::binary &data, bool isRaw = false) const;
+        [[nodiscard]] std::vector<rtc::CopyOnWriteBuffer> preReadData(const rtc::CopyOnWriteBuffer &data, bool isRaw = false) const;
 
         [[nodiscard]] bytes::binary preSendData(const bytes::binary &data, bool isRaw = false) const;
 
         [[nodiscard]] virtual bool supportsCompression() const = 0;
 
     private:
+        static std::atomic_int _compressionLevel;
+        static std::atomic_bool _compressionDictionary;
+
+        std::unique_ptr<bytes::GZip> compressor;
         std::shared_ptr<SignalingEncryption> signalingEncryption;
         std::weak_ptr<SignalingEncryption> signalingEncryptionWeak;
     };
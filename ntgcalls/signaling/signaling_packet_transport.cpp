@@ -5,10 +5,10 @@
 #include "signaling_packet_transport.hpp"
 
 namespace signaling {
-    void SignalingPacketTransport::receiveData(const bytes::binary& data) {
+    void SignalingPacketTransport::receiveData(const rtc::CopyOnWriteBuffer& data) {
         NotifyPacketReceived(
             rtc::ReceivedPacket(
-                  rtc::MakeArrayView(data.data(), data.size()),
+                  rtc::MakeArrayView(data.cdata(), data.size()),
                 rtc::SocketAddress()
             )
         );
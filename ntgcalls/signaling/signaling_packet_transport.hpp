@@ -15,7 +15,7 @@ namespace signaling {
     public:
         explicit SignalingPacketTransport(const std::function<void(const bytes::binary&)>& emitData): emitData(emitData), transportName("signaling") {}
 
-        void receiveData(const bytes::binary& data);
+        void receiveData(const rtc::CopyOnWriteBuffer& data);
 
         [[nodiscard]] const std::string& transport_name() const override;
 
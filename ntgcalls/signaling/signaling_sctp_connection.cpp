@@ -15,7 +15,10 @@ namespace signaling {
         const DataEmitter& onEmitData,
         const DataReceiver& onSignalData,
         const bool allowCompression
-    ): SignalingInterface(networkThread, signalingThread, key, onEmitData, onSignalData), allowCompression(allowCompression) {
+    ): SignalingInterface(networkThread, signalingThread, key, onEmitData, onSignalData),
+        signalingSafety(webrtc::PendingTaskSafetyFlag::CreateDetached()),
+        networkSafety(webrtc::PendingTaskSafetyFlag::CreateDetached()),
+        allowCompression(allowCompression) {
         networkThread->BlockingCall([&] {
             packetTransport = std::make_unique<SignalingPacketTransport>(onEmitData);
             sctpTransportFactory = std::make_unique<cricket::SctpTransportFactory>(networkThread);
@@ -27,64 +30,89 @@ namespace signaling {
     }
 
     SignalingSctpConnection::~SignalingSctpConnection() {
+        signalingThread->BlockingCall([&] {
+            signalingSafety->SetNotAlive();
+        });
         networkThread->BlockingCall([&] {
+            networkSafety->SetNotAlive();
             sctpTransport = nullptr;
             sctpTransportFactory = nullptr;
             packetTransport = nullptr;
         });
     }
 
-    void SignalingSctpConnection::receive(const bytes::binary& data) const {
-        networkThread->BlockingCall([&] {
+    void SignalingSctpConnection::receive(const rtc::CopyOnWriteBuffer& data) const {
+        networkThread->PostTask(webrtc::SafeTask(networkSafety, [this, data] {
             packetTransport->receiveData(data);
-        });
+        }));
     }
 
     void SignalingSctpConnection::send(const bytes::binary& data) {
-        networkThread->BlockingCall([&] {
-            const auto encryptedData = preSendData(data);
-            if (isReadyToSend) {
-                webrtc::SendDataParams params;
-                params.type = webrtc::DataMessageType::kBinary;
-                params.ordered = true;
-
-                rtc::CopyOnWriteBuffer payload;
-                payload.AppendData(encryptedData.data(), encryptedData.size());
+        std::lock_guard lock(outgoingMutex);
+        outgoingData.push_back(data);
+        if (encryptScheduled) {
+            return;
+        }
+        encryptScheduled = true;
+        signalingThread->PostTask(webrtc::SafeTask(signalingSafety, [this] {
+            encryptOutgoing();
+        }));
+    }
 
-                if (const auto result = sctpTransport->SendData(0, params, payload); !result.ok()) {
-                    RTC_LOG(LS_ERROR) << "Failed to send data: " << result.message();
-                    isReadyToSend = false;
-                    pendingData.push_back(encryptedData);
-                }
-            } else {
-                pendingData.push_back(encryptedData);
+    void SignalingSctpConnection::encryptOutgoing() {
+        assert(signalingThread->IsCurrent());
+        std::vector<bytes::binary> batch;
+        {
+            std::lock_guard lock(outgoingMutex);
+            batch.swap(outgoingData);
+            encryptScheduled = false;
+        }
+        std::vector<rtc::CopyOnWriteBuffer> encryptedBatch;
+        encryptedBatch.reserve(batch.size());
+        for (const auto& data : batch) {
+            if (const auto encryptedData = preSendData(data); !encryptedData.empty()) {
+                encryptedBatch.emplace_back(encryptedData.data(), encryptedData.size());
             }
-        });
+        }
+        if (encryptedBatch.empty()) {
+            return;
+        }
+        networkThread->PostTask(webrtc::SafeTask(networkSafety, [this, encryptedBatch = std::move(encryptedBatch)]() mutable {
+            for (auto& packet : encryptedBatch) {
+                pendingData.push_back(std::move(packet));
+            }
+            if (isReadyToSend) {
+                sendPending();
+            }
+        }));
     }
 
-    void SignalingSctpConnection::OnReadyToSend() {
+    void SignalingSctpConnection::sendPending() {
         assert(networkThread->IsCurrent());
-        isReadyToSend = true;
-        for (const auto &data : pendingData) {
-            webrtc::SendDataParams params;
-            params.type = webrtc::DataMessageType::kBinary;
-            params.ordered = true;
-            rtc::CopyOnWriteBuffer payload;
-            payload.AppendData(data.data(), data.size());
-            if (const auto result = sctpTransport->SendData(0, params, payload); !result.ok()) {
+        webrtc::SendDataParams params;
+        params.type = webrtc::DataMessageType::kBinary;
+        params.ordered = true;
+        while (!pendingData.empty()) {
+            if (const auto result = sctpTransport->SendData(0, params, pendingData.front()); !result.ok()) {
                 RTC_LOG(LS_ERROR) << "Failed to send data: " << result.message();
-                pendingData.push_back(data);
                 isReadyToSend = false;
+                return;
             }
+            pendingData.pop_front();
         }
-        pendingData.clear();
+    }
+
+    void SignalingSctpConnection::OnReadyToSend() {
+        assert(networkThread->IsCurrent());
+        isReadyToSend = true;
+        sendPending();
     }
 
     void SignalingSctpConnection::OnDataReceived(int channel_id, webrtc::DataMessageType type, const rtc::CopyOnWriteBuffer& buffer) {
         assert(networkThread->IsCurrent());
-        signalingThread->PostTask([this, buffer] {
-            onSignalData(preReadData({buffer.data(), buffer.data() + buffer.size()}));
-        });
+        signalingThread->PostTask(webrtc::SafeTask(signalingSafety, [this, buffer] {
+            onSignalData(preReadData(buffer));
+        }));
     }
 
     void SignalingSctpConnection::OnTransportClosed(webrtc::RTCError error) {
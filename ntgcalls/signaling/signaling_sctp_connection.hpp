@@ -3,6 +3,10 @@
 //
 
 #pragma once
+#include <deque>
+#include <mutex>
+#include <api/task_queue/pending_task_safety_flag.h>
+
 #include "signaling_interface.hpp"
 #include "signaling_packet_transport.hpp"
 #include "media/sctp/sctp_transport_factory.h"
@@ -13,10 +17,19 @@ namespace signaling {
         std::unique_ptr<cricket::SctpTransportFactory> sctpTransportFactory;
         std::unique_ptr<SignalingPacketTransport> packetTransport;
         std::unique_ptr<cricket::SctpTransportInternal> sctpTransport;
-        std::vector<bytes::binary> pendingData;
+        // Network thread only, encrypted packets waiting for the SCTP transport
+        std::deque<rtc::CopyOnWriteBuffer> pendingData;
+        std::mutex outgoingMutex;
+        std::vector<bytes::binary> outgoingData;
+        bool encryptScheduled = false;
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> signalingSafety, networkSafety;
         bool allowCompression = false;
         bool isReadyToSend = false;
 
+        void encryptOutgoing();
+
+        void sendPending();
+
     public:
         SignalingSctpConnection(
             rtc::Thread* networkThread,
@@ -30,7 +43,7 @@ namespace signaling {
 
         ~SignalingSctpConnection() override;
 
-        void receive(const bytes::binary& data) const override;
+        void receive(const rtc::CopyOnWriteBuffer& data) const override;
 
         void send(const bytes::binary& data) override;
 
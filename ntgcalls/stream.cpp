@@ -32,8 +32,8 @@ namespace ntgcalls {
     }
 
     void Stream::addTracks(const std::unique_ptr<wrtc::NetworkInterface>& pc) {
-        audioTrack = pc->addTrack(audio->createTrack());
-        videoTrack = pc->addTrack(video->createTrack());
+        audioTrack = pc->addTrack(audio->createTrack(pc->getFactory()));
+        videoTrack = pc->addTrack(video->createTrack(pc->getFactory()));
     }
 
     void Stream::checkStream() const {
@@ -120,6 +120,20 @@ namespace ntgcalls {
         return 0;
     }
 
+    double Stream::pacingJitter() {
+        std::shared_lock lock(mutex);
+        double jitter = 0;
+        if (reader) {
+            if (reader->audio) {
+                jitter = std::max(jitter, audio->pacingJitter());
+            }
+            if (reader->video) {
+                jitter = std::max(jitter, video->pacingJitter());
+            }
+        }
+        return jitter;
+    }
+
     Stream::Status Stream::status() {
         std::shared_lock lock(mutex);
         if (reader && (reader->audio || reader->video)) {
@@ -161,6 +175,9 @@ namespace ntgcalls {
                             lock.lock();
                         }
                         bs->sendData(sample.get(), captureTime);
+                        if (!firstFrameSent.exchange(true)) {
+                            (void) onFirstFrameSent();
+                        }
                     }
                     checkStream();
                 }
@@ -197,8 +214,8 @@ namespace ntgcalls {
             audioTrack->set_enabled(!isMuted);
             changed = true;
         }
-        if (videoTrack && !videoTrack->enabled() != isMuted) {
-            videoTrack->set_enabled(!isMuted);
+        if (videoTrack && videoTrack->enabled() != (!isMuted && !audioOnly)) {
+            videoTrack->set_enabled(!isMuted && !audioOnly);
             changed = true;
         }
         if (changed) {
@@ -207,6 +224,23 @@ namespace ntgcalls {
         return changed;
     }
 
+    void Stream::setVideoAdaptation(const double scaleResolutionDownBy, const int maxFramerate) {
+        std::shared_lock lock(mutex);
+        video->setAdaptation(scaleResolutionDownBy, maxFramerate);
+    }
+
+    void Stream::setAudioOnly(const bool enable) {
+        std::lock_guard lock(mutex);
+        if (audioOnly == enable) {
+            return;
+        }
+        audioOnly = enable;
+        if (videoTrack) {
+            videoTrack->set_enabled(!enable && (!audioTrack || audioTrack->enabled()));
+        }
+        checkUpgrade();
+    }
+
     void Stream::onStreamEnd(const std::function<void(Type)> &callback) {
         onEOF = callback;
     }
@@ -214,4 +248,8 @@ namespace ntgcalls {
     void Stream::onUpgrade(const std::function<void(MediaState)> &callback) {
         onChangeStatus = callback;
     }
+
+    void Stream::onFirstFrame(const std::function<void()> &callback) {
+        onFirstFrameSent = callback;
+    }
 }
@@ -42,10 +42,16 @@ namespace ntgcalls {
 
         bool unmute();
 
+        void setVideoAdaptation(double scaleResolutionDownBy, int maxFramerate);
+
+        void setAudioOnly(bool enable);
+
         MediaState getState();
 
         uint64_t time();
 
+        double pacingJitter();
+
         Status status();
 
         void addTracks(const std::unique_ptr<wrtc::NetworkInterface> &pc);
@@ -54,15 +60,18 @@ namespace ntgcalls {
 
         void onUpgrade(const std::function<void(MediaState)> &callback);
 
+        void onFirstFrame(const std::function<void()> &callback);
+
     private:
         std::unique_ptr<AudioStreamer> audio;
         std::unique_ptr<VideoStreamer> video;
         std::unique_ptr<wrtc::MediaTrackInterface> audioTrack, videoTrack;
         std::unique_ptr<MediaReaderFactory> reader;
-        bool idling = false;
-        std::atomic_bool hasVideo = false, changing = false, quit = false;
+        bool idling = false, audioOnly = false;
+        std::atomic_bool hasVideo = false, changing = false, quit = false, firstFrameSent = false;
         wrtc::synchronized_callback<Type> onEOF;
         wrtc::synchronized_callback<MediaState> onChangeStatus;
+        wrtc::synchronized_callback<void> onFirstFrameSent;
         std::thread thread;
         rtc::Thread* workerThread;
         std::shared_mutex mutex;
@@ -0,0 +1,142 @@
+//
+// Created by Laky64 on 17/09/2024.
+//
+
+#include "bandwidth_monitor.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace ntgcalls {
+    BandwidthMonitor::BandwidthMonitor(rtc::Thread* updateThread, CallsProvider callsProvider):
+        updateThread(updateThread), callsProvider(std::move(callsProvider)), timerService(wrtc::TimerService::GetOrCreateDefault()), safety(webrtc::PendingTaskSafetyFlag::CreateDetached()) {}
+
+    BandwidthMonitor::~BandwidthMonitor() {
+        RTC_DCHECK_RUN_ON(updateThread);
+        safety->SetNotAlive();
+        {
+            std::lock_guard lock(mutex);
+            if (timer) {
+                timerService->cancel(timer);
+                timer = 0;
+            }
+        }
+        bitrateCallback = nullptr;
+        congestionCallback = nullptr;
+        timerService = nullptr;
+        wrtc::TimerService::UnRef();
+    }
+
+    void BandwidthMonitor::setPolicy(const std::optional<BandwidthPolicy>& newPolicy) {
+        {
+            std::lock_guard lock(mutex);
+            policy = newPolicy;
+        }
+        start();
+    }
+
+    void BandwidthMonitor::onBitrateChange(const std::function<void(int64_t, int64_t)>& callback) {
+        bitrateCallback = callback;
+        start();
+    }
+
+    void BandwidthMonitor::onCongestion(const std::function<void(int64_t, CongestionInfo)>& callback) {
+        congestionCallback = callback;
+        start();
+    }
+
+    void BandwidthMonitor::start() {
+        std::lock_guard lock(mutex);
+        if (timer) {
+            return;
+        }
+        timer = timerService->schedulePeriodic(Interval, [this] {
+            updateThread->PostTask(webrtc::SafeTask(safety, [this] {
+                evaluate();
+            }));
+            return true;
+        });
+    }
+
+    void BandwidthMonitor::evaluate() {
+        // Replies of an earlier tick that are still in flight are dropped
+        const auto currentTick = ++tick;
+        std::map<int64_t, State> newStates;
+        for (const auto& [chatId, call] : callsProvider()) {
+            newStates[chatId] = states[chatId];
+            call->bandwidthStats([this, currentTick, chatId, weakCall = std::weak_ptr(call)](const wrtc::BandwidthStats& stats) {
+                updateThread->PostTask(webrtc::SafeTask(safety, [this, currentTick, chatId, weakCall, stats] {
+                    if (currentTick != tick) {
+                        return;
+                    }
+                    if (const auto call = weakCall.lock()) {
+                        update(chatId, call, stats);
+                    }
+                }));
+            });
+        }
+        states = std::move(newStates);
+    }
+
+    void BandwidthMonitor::update(const int64_t chatId, const std::shared_ptr<CallInterface>& call, const wrtc::BandwidthStats& stats) {
+        std::optional<BandwidthPolicy> currentPolicy;
+        {
+            std::lock_guard lock(mutex);
+            currentPolicy = policy;
+        }
+        const auto it = states.find(chatId);
+        if (it == states.end()) {
+            return;
+        }
+        auto& state = it->second;
+        const auto bitrate = stats.sendBandwidth;
+        if (bitrate <= 0) {
+            return;
+        }
+        if (!state.bitrate || std::abs(bitrate - state.bitrate) >= static_cast<double>(state.bitrate) * ChangeRatio) {
+            state.bitrate = bitrate;
+            (void) bitrateCallback(chatId, bitrate);
+        }
+        state.peak = std::max(static_cast<int64_t>(static_cast<double>(state.peak) * PeakDecay), bitrate);
+        const bool congested = stats.fractionLost >= CongestionLoss || static_cast<double>(bitrate) < static_cast<double>(state.peak) * CongestionRatio;
+        const auto adaptation = currentPolicy ? adapt(state, bitrate, *currentPolicy, state.restoreTicks) : CongestionInfo::Adaptation::None;
+        if (adaptation != state.adaptation) {
+            RTC_LOG(LS_INFO) << "Adapting call " << chatId << " to level " << static_cast<int>(adaptation) << ", target bitrate " << bitrate;
+            call->setAdaptation(adaptation, currentPolicy.value_or(BandwidthPolicy{}));
+        }
+        if (congested != state.congested || adaptation != state.adaptation) {
+            state.congested = congested;
+            state.adaptation = adaptation;
+            (void) congestionCallback(chatId, CongestionInfo{
+                congested,
+                bitrate,
+                stats.fractionLost,
+                stats.rttMs,
+                adaptation,
+            });
+        }
+    }
+
+    CongestionInfo::Adaptation BandwidthMonitor::adapt(const State& state, const int64_t bitrate, const BandwidthPolicy& policy, int& restoreTicks) {
+        auto target = CongestionInfo::Adaptation::None;
+        if (bitrate < policy.audioOnlyBitrate) {
+            target = CongestionInfo::Adaptation::AudioOnly;
+        } else if (bitrate < policy.reduceBitrate) {
+            target = CongestionInfo::Adaptation::Reduced;
+        }
+        if (target >= state.adaptation) {
+            restoreTicks = 0;
+            return target;
+        }
+        const auto threshold = state.adaptation == CongestionInfo::Adaptation::AudioOnly ? policy.audioOnlyBitrate : policy.reduceBitrate;
+        if (static_cast<double>(bitrate) < static_cast<double>(threshold) * RestoreRatio) {
+            restoreTicks = 0;
+            return state.adaptation;
+        }
+        if (++restoreTicks < RestoreTicks) {
+            return state.adaptation;
+        }
+        restoreTicks = 0;
+        return static_cast<CongestionInfo::Adaptation>(static_cast<int>(state.adaptation) - 1);
+    }
+} // ntgcalls
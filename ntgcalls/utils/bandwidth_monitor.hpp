@@ -0,0 +1,75 @@
+//
+// Created by Laky64 on 17/09/2024.
+//
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <api/task_queue/pending_task_safety_flag.h>
+#include <rtc_base/thread.h>
+
+#include "ntgcalls/instances/call_interface.hpp"
+#include "ntgcalls/models/bandwidth_policy.hpp"
+#include "ntgcalls/models/congestion_info.hpp"
+#include "wrtc/utils/timer_service.hpp"
+
+namespace ntgcalls {
+
+    // Polls the send-side bandwidth estimate of every call, reports target
+    // bitrate and congestion changes and, when a policy is set, adapts the
+    // outgoing video source to the available bandwidth. Estimates are read
+    // from each call's Call stats asynchronously. Lives on the update thread.
+    class BandwidthMonitor {
+    public:
+        using CallsProvider = std::function<std::vector<std::pair<int64_t, std::shared_ptr<CallInterface>>>()>;
+
+        BandwidthMonitor(rtc::Thread* updateThread, CallsProvider callsProvider);
+
+        ~BandwidthMonitor();
+
+        void setPolicy(const std::optional<BandwidthPolicy>& newPolicy);
+
+        void onBitrateChange(const std::function<void(int64_t, int64_t)>& callback);
+
+        void onCongestion(const std::function<void(int64_t, CongestionInfo)>& callback);
+
+    private:
+        static constexpr double ChangeRatio = 0.1;
+        static constexpr double CongestionLoss = 0.1;
+        static constexpr double CongestionRatio = 0.5;
+        static constexpr double PeakDecay = 0.95;
+        static constexpr double RestoreRatio = 1.25;
+        static constexpr int RestoreTicks = 3;
+        static constexpr auto Interval = webrtc::TimeDelta::Seconds(1);
+
+        struct State {
+            int64_t bitrate = 0;
+            int64_t peak = 0;
+            bool congested = false;
+            CongestionInfo::Adaptation adaptation = CongestionInfo::Adaptation::None;
+            int restoreTicks = 0;
+        };
+
+        rtc::Thread* updateThread;
+        CallsProvider callsProvider;
+        rtc::scoped_refptr<wrtc::TimerService> timerService;
+        wrtc::TimerService::TimerId timer = 0;
+        std::mutex mutex;
+        std::optional<BandwidthPolicy> policy;
+        std::map<int64_t, State> states;
+        uint64_t tick = 0;
+        wrtc::synchronized_callback<int64_t, int64_t> bitrateCallback;
+        wrtc::synchronized_callback<int64_t, CongestionInfo> congestionCallback;
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety;
+
+        void start();
+
+        void evaluate();
+
+        void update(int64_t chatId, const std::shared_ptr<CallInterface>& call, const wrtc::BandwidthStats& stats);
+
+        static CongestionInfo::Adaptation adapt(const State& state, int64_t bitrate, const BandwidthPolicy& policy, int& restoreTicks);
+    };
+
+} // ntgcalls
@@ -16,6 +16,7 @@ RTC_LOG(LS_INFO) << "Worker finished";\
 #ifdef PYTHON_ENABLED
 #include "wrtc/utils/binary.hpp"
 #include <pybind11/pybind11.h>
+#include <rtc_base/copy_on_write_buffer.h>
 // ReSharper disable once CppUnusedIncludeDirective
 #include <pybind11/stl.h>
 namespace py = pybind11;
@@ -32,13 +33,18 @@ std::optional<T> toCBytes(const std::optional<py::bytes>& p) {
     return std::nullopt;
 }
 
-template <typename T, typename = std::enable_if_t<std::is_same_v<T, bytes::vector> || std::is_same_v<T, bytes::binary>>>
+template <typename T, typename = std::enable_if_t<std::is_same_v<T, bytes::vector> || std::is_same_v<T, bytes::binary> || std::is_same_v<T, rtc::CopyOnWriteBuffer>>>
 T toCBytes(const py::bytes& p) {
     const auto data = reinterpret_cast<const uint8_t*>(PYBIND11_BYTES_AS_STRING(p.ptr()));
     const auto size = static_cast<size_t>(PYBIND11_BYTES_SIZE(p.ptr()));
-    auto sharedPtr = T(size);
-    std::memcpy(sharedPtr.data(), data, size);
-    return sharedPtr;
+    if constexpr (std::is_same_v<T, rtc::CopyOnWriteBuffer>) {
+        // Later signaling stages share or slice this buffer instead of copying it again
+        return T(data, size);
+    } else {
+        auto sharedPtr = T(size);
+        std::memcpy(sharedPtr.data(), data, size);
+        return sharedPtr;
+    }
 }
 
 template <typename T, typename = std::enable_if_t<std::is_same_v<T, bytes::vector> || std::is_same_v<T, bytes::binary>>>
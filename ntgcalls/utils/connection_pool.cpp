@@ -0,0 +1,80 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include "connection_pool.hpp"
+
+#include <rtc_base/logging.h>
+
+namespace ntgcalls {
+    ConnectionPool::ConnectionPool(rtc::Thread* updateThread): updateThread(updateThread), safety(webrtc::PendingTaskSafetyFlag::CreateDetached()) {}
+
+    ConnectionPool::~ConnectionPool() {
+        RTC_DCHECK_RUN_ON(updateThread);
+        safety->SetNotAlive();
+        std::lock_guard lock(mutex);
+        connections.clear();
+    }
+
+    void ConnectionPool::setSize(const size_t value) {
+        std::deque<std::unique_ptr<wrtc::PeerConnection>> released;
+        {
+            std::lock_guard lock(mutex);
+            size = value;
+            while (connections.size() > size) {
+                released.push_back(std::move(connections.back()));
+                connections.pop_back();
+            }
+        }
+        scheduleRefill();
+    }
+
+    std::unique_ptr<wrtc::PeerConnection> ConnectionPool::take() {
+        std::unique_ptr<wrtc::PeerConnection> connection;
+        {
+            std::lock_guard lock(mutex);
+            if (connections.empty()) {
+                return nullptr;
+            }
+            connection = std::move(connections.front());
+            connections.pop_front();
+        }
+        scheduleRefill();
+        return connection;
+    }
+
+    void ConnectionPool::scheduleRefill() {
+        std::lock_guard lock(mutex);
+        if (refillScheduled || connections.size() >= size) {
+            return;
+        }
+        refillScheduled = true;
+        updateThread->PostTask(webrtc::SafeTask(safety, [this] {
+            refill();
+        }));
+    }
+
+    void ConnectionPool::refill() {
+        while (true) {
+            {
+                std::lock_guard lock(mutex);
+                if (connections.size() >= size) {
+                    refillScheduled = false;
+                    return;
+                }
+            }
+            std::unique_ptr<wrtc::PeerConnection> connection;
+            try {
+                connection = std::make_unique<wrtc::PeerConnection>();
+                connection->prepareTransceivers();
+            } catch (const std::exception& e) {
+                RTC_LOG(LS_WARNING) << "Failed to prepare pooled connection: " << e.what();
+                std::lock_guard lock(mutex);
+                refillScheduled = false;
+                return;
+            }
+            std::lock_guard lock(mutex);
+            connections.push_back(std::move(connection));
+        }
+    }
+} // ntgcalls
@@ -0,0 +1,45 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <api/task_queue/pending_task_safety_flag.h>
+#include <rtc_base/thread.h>
+
+#include "wrtc/interfaces/peer_connection.hpp"
+
+namespace ntgcalls {
+
+    // Keeps idle group call connections built ahead of time, so that joining
+    // a call only waits for the network. A pooled connection already has its
+    // audio and video transceivers, which GroupCall::init's tracks take over.
+    // Media channels, codec negotiation, ICE gathering and DTLS stay cold until
+    // the call sets its local description. Lives on the update thread.
+    class ConnectionPool {
+    public:
+        explicit ConnectionPool(rtc::Thread* updateThread);
+
+        ~ConnectionPool();
+
+        void setSize(size_t value);
+
+        std::unique_ptr<wrtc::PeerConnection> take();
+
+    private:
+        rtc::Thread* updateThread;
+        std::mutex mutex;
+        size_t size = 0;
+        bool refillScheduled = false;
+        std::deque<std::unique_ptr<wrtc::PeerConnection>> connections;
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety;
+
+        void scheduleRefill();
+
+        void refill();
+    };
+
+} // ntgcalls
@@ -0,0 +1,150 @@
+//
+// Created by Laky64 on 15/09/2024.
+//
+
+#include "cpu_governor.hpp"
+
+#include <algorithm>
+#include <rtc_base/time_utils.h>
+
+namespace ntgcalls {
+    CpuGovernor::CpuGovernor(rtc::Thread* updateThread, CallsProvider callsProvider):
+        updateThread(updateThread), callsProvider(std::move(callsProvider)), timerService(wrtc::TimerService::GetOrCreateDefault()), safety(webrtc::PendingTaskSafetyFlag::CreateDetached()) {}
+
+    CpuGovernor::~CpuGovernor() {
+        RTC_DCHECK_RUN_ON(updateThread);
+        safety->SetNotAlive();
+        setBudget(0);
+        decisionCallback = nullptr;
+        timerService = nullptr;
+        wrtc::TimerService::UnRef();
+    }
+
+    void CpuGovernor::setBudget(const double usage) {
+        std::lock_guard lock(mutex);
+        maxUsage = usage;
+        if (usage > 0 && !timer) {
+            timer = timerService->schedulePeriodic(Interval, [this] {
+                updateThread->PostTask(webrtc::SafeTask(safety, [this] {
+                    evaluate();
+                }));
+                return true;
+            });
+        } else if (usage <= 0 && timer) {
+            timerService->cancel(timer);
+            timer = 0;
+        }
+    }
+
+    void CpuGovernor::onDecision(const std::function<void(int64_t, GovernorDecision)>& callback) {
+        decisionCallback = callback;
+    }
+
+    void CpuGovernor::evaluate() {
+        if (maxUsage <= 0) {
+            return;
+        }
+        const double cpuUsage = hardwareInfo.getCpuUsage();
+        if (cpuUsage < 0) {
+            return;
+        }
+        // A tick whose replies did not all arrive is dropped with its stats
+        const auto currentTick = ++tick;
+        const auto calls = callsProvider();
+        tickCpuUsage = cpuUsage;
+        expectedReplies = calls.size();
+        replies.clear();
+        if (calls.empty()) {
+            decide();
+            return;
+        }
+        for (const auto& [chatId, call] : calls) {
+            call->encoderStats([this, currentTick, chatId, weakCall = std::weak_ptr(call)](const wrtc::EncoderStats& stats) {
+                updateThread->PostTask(webrtc::SafeTask(safety, [this, currentTick, chatId, weakCall, stats] {
+                    if (currentTick != tick) {
+                        return;
+                    }
+                    replies.push_back({chatId, weakCall, stats, rtc::TimeMillis()});
+                    if (replies.size() == expectedReplies) {
+                        decide();
+                    }
+                }));
+            });
+        }
+    }
+
+    void CpuGovernor::decide() {
+        const double budget = maxUsage;
+        if (budget <= 0) {
+            return;
+        }
+        const double cpuUsage = tickCpuUsage;
+        std::vector<Candidate> candidates;
+        std::map<int64_t, Sample> newSamples;
+        for (auto& [chatId, weakCall, stats, now] : replies) {
+            auto call = weakCall.lock();
+            if (!call) {
+                continue;
+            }
+            double encodeUsage = 0;
+            if (const auto it = samples.find(chatId); it != samples.end() && now > it->second.timestamp && stats.totalEncodeTimeMs >= it->second.stats.totalEncodeTimeMs) {
+                encodeUsage = (stats.totalEncodeTimeMs - it->second.stats.totalEncodeTimeMs) / static_cast<double>(now - it->second.timestamp) * 100;
+            }
+            newSamples[chatId] = {stats, now};
+            candidates.push_back({chatId, std::move(call), 0, 0, encodeUsage});
+        }
+        replies.clear();
+        samples = std::move(newSamples);
+        for (auto& candidate : candidates) {
+            candidate.priority = candidate.call->getPriority();
+            candidate.level = candidate.call->degradationLevel();
+        }
+
+        if (cpuUsage > budget) {
+            lowTicks = 0;
+            const Candidate* target = nullptr;
+            for (const auto& candidate : candidates) {
+                if (candidate.level >= MaxLevel || candidate.encodeUsage <= 0) {
+                    continue;
+                }
+                if (!target || candidate.priority < target->priority || (candidate.priority == target->priority && candidate.encodeUsage > target->encodeUsage)) {
+                    target = &candidate;
+                }
+            }
+            if (target) {
+                apply(*target, GovernorDecision::Action::Degrade, cpuUsage);
+            }
+        } else if (cpuUsage < budget * RestoreRatio) {
+            if (++lowTicks < RestoreTicks) {
+                return;
+            }
+            lowTicks = 0;
+            const Candidate* target = nullptr;
+            for (const auto& candidate : candidates) {
+                if (candidate.level <= 0) {
+                    continue;
+                }
+                if (!target || candidate.priority > target->priority || (candidate.priority == target->priority && candidate.encodeUsage < target->encodeUsage)) {
+                    target = &candidate;
+                }
+            }
+            if (target) {
+                apply(*target, GovernorDecision::Action::Restore, cpuUsage);
+            }
+        } else {
+            lowTicks = 0;
+        }
+    }
+
+    void CpuGovernor::apply(const Candidate& candidate, const GovernorDecision::Action action, const double cpuUsage) {
+        const int level = action == GovernorDecision::Action::Degrade ? candidate.level + 1 : candidate.level - 1;
+        RTC_LOG(LS_INFO) << (action == GovernorDecision::Action::Degrade ? "Degrading" : "Restoring") << " call " << candidate.chatId << " to level " << level << ", cpu usage " << cpuUsage << "%";
+        candidate.call->setDegradation(level);
+        (void) decisionCallback(candidate.chatId, GovernorDecision{
+            action,
+            level,
+            cpuUsage,
+            candidate.encodeUsage,
+        });
+    }
+} // ntgcalls
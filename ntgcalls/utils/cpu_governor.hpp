@@ -0,0 +1,85 @@
+//
+// Created by Laky64 on 15/09/2024.
+//
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <api/task_queue/pending_task_safety_flag.h>
+#include <rtc_base/thread.h>
+
+#include "hardware_info.hpp"
+#include "ntgcalls/instances/call_interface.hpp"
+#include "ntgcalls/models/governor_decision.hpp"
+#include "wrtc/utils/timer_service.hpp"
+
+namespace ntgcalls {
+
+    // Keeps the process under a CPU budget by stepping the video encoders of
+    // the lowest priority calls down first, and back up once there is headroom.
+    // Encoder stats are requested asynchronously, a tick decides once every
+    // call has answered, so the update thread never waits on a media thread.
+    // Lives on the update thread.
+    class CpuGovernor {
+    public:
+        using CallsProvider = std::function<std::vector<std::pair<int64_t, std::shared_ptr<CallInterface>>>()>;
+
+        CpuGovernor(rtc::Thread* updateThread, CallsProvider callsProvider);
+
+        ~CpuGovernor();
+
+        void setBudget(double maxUsage);
+
+        void onDecision(const std::function<void(int64_t, GovernorDecision)>& callback);
+
+    private:
+        static constexpr int MaxLevel = 5;
+        static constexpr int RestoreTicks = 3;
+        static constexpr double RestoreRatio = 0.75;
+        static constexpr auto Interval = webrtc::TimeDelta::Seconds(2);
+
+        struct Sample {
+            wrtc::EncoderStats stats;
+            int64_t timestamp = 0;
+        };
+
+        struct Candidate {
+            int64_t chatId;
+            std::shared_ptr<CallInterface> call;
+            int priority;
+            int level;
+            double encodeUsage;
+        };
+
+        struct Reply {
+            int64_t chatId;
+            std::weak_ptr<CallInterface> call;
+            wrtc::EncoderStats stats;
+            int64_t timestamp;
+        };
+
+        rtc::Thread* updateThread;
+        CallsProvider callsProvider;
+        HardwareInfo hardwareInfo;
+        rtc::scoped_refptr<wrtc::TimerService> timerService;
+        wrtc::TimerService::TimerId timer = 0;
+        std::mutex mutex;
+        std::atomic<double> maxUsage = 0;
+        int lowTicks = 0;
+        std::map<int64_t, Sample> samples;
+        uint64_t tick = 0;
+        size_t expectedReplies = 0;
+        double tickCpuUsage = 0;
+        std::vector<Reply> replies;
+        wrtc::synchronized_callback<int64_t, GovernorDecision> decisionCallback;
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety;
+
+        void evaluate();
+
+        void decide();
+
+        void apply(const Candidate& candidate, GovernorDecision::Action action, double cpuUsage);
+    };
+
+} // ntgcalls
@@ -0,0 +1,70 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#include "setup_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ntgcalls {
+    std::mutex SetupHistogram::_mutex;
+    std::array<SetupHistogram::Histogram, SetupTimings::MilestoneCount> SetupHistogram::_histograms;
+
+    void SetupHistogram::Add(SetupTimings::Milestone milestone, const int64_t elapsedMs) {
+        std::lock_guard lock(_mutex);
+        auto& histogram = _histograms[static_cast<size_t>(milestone)];
+        histogram.buckets[bucketOf(elapsedMs)]++;
+        histogram.count++;
+        histogram.max = std::max(histogram.max, elapsedMs);
+    }
+
+    std::vector<SetupHistogram::Summary> SetupHistogram::Snapshot() {
+        std::lock_guard lock(_mutex);
+        std::vector<Summary> summaries;
+        for (size_t i = 0; i < _histograms.size(); i++) {
+            const auto& histogram = _histograms[i];
+            if (!histogram.count) {
+                continue;
+            }
+            summaries.push_back({
+                static_cast<SetupTimings::Milestone>(i),
+                histogram.count,
+                std::min(percentile(histogram, 0.5), histogram.max),
+                std::min(percentile(histogram, 0.9), histogram.max),
+                std::min(percentile(histogram, 0.99), histogram.max),
+                histogram.max,
+            });
+        }
+        return summaries;
+    }
+
+    void SetupHistogram::Reset() {
+        std::lock_guard lock(_mutex);
+        _histograms = {};
+    }
+
+    size_t SetupHistogram::bucketOf(const int64_t elapsedMs) {
+        if (elapsedMs <= 1) {
+            return 0;
+        }
+        const auto bucket = static_cast<size_t>(std::ceil(std::log(static_cast<double>(elapsedMs)) / std::log(BucketGrowth)));
+        return std::min(bucket, BucketCount - 1);
+    }
+
+    int64_t SetupHistogram::upperBound(const size_t bucket) {
+        return static_cast<int64_t>(std::ceil(std::pow(BucketGrowth, static_cast<double>(bucket))));
+    }
+
+    int64_t SetupHistogram::percentile(const Histogram& histogram, const double ratio) {
+        const auto target = static_cast<uint64_t>(std::ceil(ratio * static_cast<double>(histogram.count)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BucketCount; i++) {
+            seen += histogram.buckets[i];
+            if (seen >= target) {
+                return upperBound(i);
+            }
+        }
+        return histogram.max;
+    }
+} // ntgcalls
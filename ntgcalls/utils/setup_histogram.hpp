@@ -0,0 +1,55 @@
+//
+// Created by Laky64 on 22/09/2024.
+//
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include "ntgcalls/models/setup_timings.hpp"
+
+namespace ntgcalls {
+
+    // Process-wide distribution of call setup milestones, shared by every
+    // NTgCalls instance. Buckets grow exponentially, so percentiles are
+    // reported as the upper bound of the bucket they fall in.
+    class SetupHistogram {
+    public:
+        struct Summary {
+            SetupTimings::Milestone milestone;
+            uint64_t count;
+            int64_t p50;
+            int64_t p90;
+            int64_t p99;
+            int64_t max;
+        };
+
+        static void Add(SetupTimings::Milestone milestone, int64_t elapsedMs);
+
+        static std::vector<Summary> Snapshot();
+
+        static void Reset();
+
+    private:
+        static constexpr size_t BucketCount = 64;
+        static constexpr double BucketGrowth = 1.2;
+
+        struct Histogram {
+            std::array<uint64_t, BucketCount> buckets{};
+            uint64_t count = 0;
+            int64_t max = 0;
+        };
+
+        static std::mutex _mutex;
+        static std::array<Histogram, SetupTimings::MilestoneCount> _histograms;
+
+        static size_t bucketOf(int64_t elapsedMs);
+
+        static int64_t upperBound(size_t bucket);
+
+        static int64_t percentile(const Histogram& histogram, double ratio);
+    };
+
+} // ntgcalls
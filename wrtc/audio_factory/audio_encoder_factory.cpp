@@ -0,0 +1,57 @@
+//
+// Created by Laky64 on 14/09/2024.
+//
+
+#include "audio_encoder_factory.hpp"
+
+#include <api/audio_codecs/audio_encoder_factory_template.h>
+#include <api/audio_codecs/g711/audio_encoder_g711.h>
+#include <api/audio_codecs/g722/audio_encoder_g722.h>
+#include <api/audio_codecs/L16/audio_encoder_L16.h>
+#include <api/audio_codecs/opus/audio_encoder_multi_channel_opus.h>
+#include <rtc_base/string_to_number.h>
+
+#include "wrtc/models/encoding_profile.hpp"
+
+namespace wrtc {
+    absl::optional<AudioEncoderOpus::Config> AudioEncoderOpus::SdpToConfig(const webrtc::SdpAudioFormat& format) {
+        auto config = webrtc::AudioEncoderOpus::SdpToConfig(format);
+        if (!config) {
+            return config;
+        }
+        if (const auto it = format.parameters.find(kCodecParamComplexity); it != format.parameters.end()) {
+            if (const auto complexity = rtc::StringToNumber<int>(it->second); complexity && *complexity >= 0 && *complexity <= 10) {
+                config->complexity = *complexity;
+                config->low_rate_complexity = *complexity;
+            }
+        }
+        return config;
+    }
+
+    void AudioEncoderOpus::AppendSupportedEncoders(std::vector<webrtc::AudioCodecSpec>* specs) {
+        webrtc::AudioEncoderOpus::AppendSupportedEncoders(specs);
+    }
+
+    webrtc::AudioCodecInfo AudioEncoderOpus::QueryAudioEncoder(const Config& config) {
+        return webrtc::AudioEncoderOpus::QueryAudioEncoder(config);
+    }
+
+    std::unique_ptr<webrtc::AudioEncoder> AudioEncoderOpus::MakeAudioEncoder(
+        const Config& config,
+        const int payload_type,
+        const absl::optional<webrtc::AudioCodecPairId> codec_pair_id,
+        const webrtc::FieldTrialsView* field_trials
+    ) {
+        return webrtc::AudioEncoderOpus::MakeAudioEncoder(config, payload_type, codec_pair_id, field_trials);
+    }
+
+    rtc::scoped_refptr<webrtc::AudioEncoderFactory> CreateAudioEncoderFactory() {
+        return webrtc::CreateAudioEncoderFactory<
+            AudioEncoderOpus,
+            webrtc::AudioEncoderMultiChannelOpus,
+            webrtc::AudioEncoderG722,
+            webrtc::AudioEncoderG711,
+            webrtc::AudioEncoderL16
+        >();
+    }
+} // wrtc
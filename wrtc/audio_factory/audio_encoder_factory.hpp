@@ -0,0 +1,31 @@
+//
+// Created by Laky64 on 14/09/2024.
+//
+
+#pragma once
+
+#include <api/audio_codecs/audio_encoder_factory.h>
+#include <api/audio_codecs/opus/audio_encoder_opus.h>
+
+namespace wrtc {
+
+    struct AudioEncoderOpus {
+        using Config = webrtc::AudioEncoderOpusConfig;
+
+        static absl::optional<Config> SdpToConfig(const webrtc::SdpAudioFormat& format);
+
+        static void AppendSupportedEncoders(std::vector<webrtc::AudioCodecSpec>* specs);
+
+        static webrtc::AudioCodecInfo QueryAudioEncoder(const Config& config);
+
+        static std::unique_ptr<webrtc::AudioEncoder> MakeAudioEncoder(
+            const Config& config,
+            int payload_type,
+            absl::optional<webrtc::AudioCodecPairId> codec_pair_id = absl::nullopt,
+            const webrtc::FieldTrialsView* field_trials = nullptr
+        );
+    };
+
+    rtc::scoped_refptr<webrtc::AudioEncoderFactory> CreateAudioEncoderFactory();
+
+} // wrtc
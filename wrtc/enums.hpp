@@ -47,4 +47,11 @@ namespace wrtc {
         Failed,
         Closed,
     };
+
+    enum class SetupMilestone: uint8_t {
+        FirstCandidate = 1 << 0,
+        GatheringComplete = 1 << 1,
+        IceConnected = 1 << 2,
+        DtlsConnected = 1 << 3,
+    };
 }
@@ -4,6 +4,8 @@
 
 #include "outgoing_audio_channel.hpp"
 
+#include <algorithm>
+
 #include "wrtc/interfaces/native_connection.hpp"
 
 namespace wrtc {
@@ -12,10 +14,11 @@ namespace wrtc {
         ChannelManager *channelManager,
         webrtc::RtpTransport* rtpTransport,
         const MediaContent& mediaContent,
+        const AudioEncodingProfile& profile,
         rtc::Thread *workerThread,
         rtc::Thread* networkThread,
         webrtc::LocalAudioSinkAdapter* sink
-    ): _ssrc(mediaContent.ssrc), workerThread(workerThread), networkThread(networkThread), sink(sink) {
+    ): _ssrc(mediaContent.ssrc), mediaContent(mediaContent), profile(profile), workerThread(workerThread), networkThread(networkThread), sink(sink) {
         cricket::AudioOptions audioOptions;
         audioOptions.echo_cancellation = false;
         audioOptions.noise_suppression = false;
@@ -33,12 +36,22 @@ namespace wrtc {
         networkThread->BlockingCall([&] {
             channel->SetRtpTransport(rtpTransport);
         });
+        applyContent();
+        set_enabled(true);
+        applyParameters();
+    }
+
+    void OutgoingAudioChannel::applyContent() const {
         std::vector<cricket::Codec> codecs;
         for (const auto &[id, name, clockrate, channels, feedbackTypes, parameters] : mediaContent.payloadTypes) {
             if (name == "opus") {
                 cricket::Codec codec = cricket::CreateAudioCodec(static_cast<int>(id), name, static_cast<int>(clockrate), channels);
-                codec.SetParam(cricket::kCodecParamUseInbandFec, 1);
-                codec.SetParam(cricket::kCodecParamPTime, 60);
+                codec.SetParam(cricket::kCodecParamUseInbandFec, profile.fec ? 1 : 0);
+                codec.SetParam(cricket::kCodecParamUseDtx, profile.dtx ? 1 : 0);
+                codec.SetParam(cricket::kCodecParamPTime, profile.ptime);
+                if (profile.complexity) {
+                    codec.SetParam(kCodecParamComplexity, *profile.complexity);
+                }
                 for (const auto &[type, subtype] : feedbackTypes) {
                     codec.AddFeedbackParam(cricket::FeedbackParam(type, subtype));
                 }
@@ -71,20 +84,49 @@ namespace wrtc {
             channel->SetLocalContent(outgoingDescription.get(), webrtc::SdpType::kOffer, errorDesc);
             channel->SetRemoteContent(incomingDescription.get(), webrtc::SdpType::kAnswer, errorDesc);
         });
-        set_enabled(true);
+    }
+
+    void OutgoingAudioChannel::applyParameters() const {
         workerThread->BlockingCall([&] {
             webrtc::RtpParameters initialParameters = channel->send_channel()->GetRtpSendParameters(_ssrc);
             webrtc::RtpParameters updatedParameters = initialParameters;
             if (updatedParameters.encodings.empty()) {
                 updatedParameters.encodings.emplace_back();
             }
-            updatedParameters.encodings[0].max_bitrate_bps = 32 * 1024;
+            updatedParameters.encodings[0].max_bitrate_bps = profile.bitrate;
             if (initialParameters != updatedParameters) {
                 channel->send_channel()->SetRtpSendParameters(_ssrc, updatedParameters);
             }
         });
     }
 
+    void OutgoingAudioChannel::setEncoding(const AudioEncodingProfile& newProfile) {
+        if (profile == newProfile) {
+            return;
+        }
+        const bool codecChanged = profile.ptime != newProfile.ptime || profile.complexity != newProfile.complexity || profile.fec != newProfile.fec || profile.dtx != newProfile.dtx;
+        profile = newProfile;
+        if (codecChanged) {
+            applyContent();
+        }
+        applyParameters();
+    }
+
+    void OutgoingAudioChannel::collectStats(CallStats& stats) const {
+        workerThread->BlockingCall([&] {
+            cricket::VoiceMediaSendInfo info;
+            if (!channel->send_channel()->GetStats(&info)) {
+                return;
+            }
+            for (const auto& sender : info.senders) {
+                stats.fractionLost = std::max(stats.fractionLost, static_cast<double>(sender.fraction_lost));
+                if (sender.rtt_ms > 0) {
+                    stats.rttMs = std::max(stats.rttMs, static_cast<double>(sender.rtt_ms));
+                }
+            }
+        });
+    }
+
     void OutgoingAudioChannel::set_enabled(const bool enable) const {
         channel->Enable(enable);
         workerThread->BlockingCall([&] {
@@ -7,23 +7,32 @@
 #include <pc/dtls_srtp_transport.h>
 #include <pc/rtp_sender.h>
 
+#include "../../../models/call_stats.hpp"
+#include "../../../models/encoding_profile.hpp"
 #include "../../../models/media_content.hpp"
 #include "../channel_manager.hpp"
 
 namespace wrtc {
     class OutgoingAudioChannel : public sigslot::has_slots<> {
         uint32_t _ssrc = 0;
+        MediaContent mediaContent;
+        AudioEncodingProfile profile;
         std::unique_ptr<cricket::VoiceChannel> channel;
         rtc::Thread* workerThread;
         rtc::Thread* networkThread;
         webrtc::LocalAudioSinkAdapter* sink;
 
+        void applyContent() const;
+
+        void applyParameters() const;
+
     public:
         OutgoingAudioChannel(
             webrtc::Call* call,
             ChannelManager* channelManager,
             webrtc::RtpTransport* rtpTransport,
             const MediaContent& mediaContent,
+            const AudioEncodingProfile& profile,
             rtc::Thread* workerThread,
             rtc::Thread* networkThread,
             webrtc::LocalAudioSinkAdapter* sink
@@ -31,6 +40,10 @@ namespace wrtc {
 
         void set_enabled(bool enable) const;
 
+        void setEncoding(const AudioEncodingProfile& newProfile);
+
+        void collectStats(CallStats& stats) const;
+
         ~OutgoingAudioChannel() override;
 
         [[nodiscard]] uint32_t ssrc() const;
@@ -4,8 +4,11 @@
 
 #include "outgoing_video_channel.hpp"
 
+#include <algorithm>
+
 #include "wrtc/interfaces/native_connection.hpp"
 #include "api/video/builtin_video_bitrate_allocator_factory.h"
+#include "api/video_codecs/video_codec.h"
 
 namespace wrtc {
     OutgoingVideoChannel::OutgoingVideoChannel(
@@ -13,12 +16,13 @@ namespace wrtc {
         ChannelManager *channelManager,
         webrtc::RtpTransport *rtpTransport,
         const MediaContent &mediaContent,
+        const VideoEncodingProfile& profile,
         rtc::Thread *workerThread,
         rtc::Thread *networkThread,
         LocalVideoAdapter* sink
-    ): _ssrc(mediaContent.ssrc), workerThread(workerThread), networkThread(networkThread), sink(sink) {
+    ): _ssrc(mediaContent.ssrc), mediaContent(mediaContent), profile(profile), workerThread(workerThread), networkThread(networkThread), sink(sink), workerSafety(webrtc::PendingTaskSafetyFlag::CreateDetached()) {
         cricket::VideoOptions videoOptions;
-        videoOptions.is_screencast = false;
+        videoOptions.is_screencast = profile.screencast;
         bitrateAllocatorFactory = webrtc::CreateBuiltinVideoBitrateAllocatorFactory();
         channel = channelManager->CreateVideoChannel(
             call,
@@ -32,20 +36,33 @@ namespace wrtc {
         networkThread->BlockingCall([&] {
             channel->SetRtpTransport(rtpTransport);
         });
+        applyContent();
+        channel->Enable(true);
+        set_enabled(true);
+        applyParameters();
+    }
+
+    void OutgoingVideoChannel::applyContent() const {
         std::vector<cricket::Codec> unsortedCodecs;
         for (const auto &[id, name, clockrate, channels, feedbackTypes, parameters] : mediaContent.payloadTypes) {
             cricket::Codec codec = cricket::CreateVideoCodec(static_cast<int>(id), name);
             for (const auto &[fst, snd] : parameters) {
                 codec.SetParam(fst, snd);
             }
+            if (profile.speed != VideoEncodingProfile::Speed::Default) {
+                codec.SetParam(kCodecParamComplexity, complexity(profile.speed));
+            }
             for (const auto &[type, subtype] : feedbackTypes) {
                 codec.AddFeedbackParam(cricket::FeedbackParam(type, subtype));
             }
             unsortedCodecs.push_back(std::move(codec));
         }
-        const std::vector<std::string> codecPreferences = {
+        std::vector<std::string> codecPreferences = {
             cricket::kH264CodecName
         };
+        if (profile.lightweightCodec) {
+            codecPreferences.emplace_back(cricket::kVp8CodecName);
+        }
         std::vector<cricket::Codec> codecs;
         for (const auto &name : codecPreferences) {
             for (const auto &codec : unsortedCodecs) {
@@ -97,21 +114,87 @@ namespace wrtc {
             channel->SetLocalContent(outgoingVideoDescription.get(), webrtc::SdpType::kOffer, errorDesc);
             channel->SetRemoteContent(incomingVideoDescription.get(), webrtc::SdpType::kAnswer, errorDesc);
         });
-        channel->Enable(true);
-        set_enabled(true);
+    }
+
+    void OutgoingVideoChannel::applyParameters() const {
         workerThread->BlockingCall([&] {
             webrtc::RtpParameters rtpParameters = channel->send_channel()->GetRtpSendParameters(_ssrc);
             rtpParameters.degradation_preference = webrtc::DegradationPreference::MAINTAIN_RESOLUTION;
+            for (auto& encoding : rtpParameters.encodings) {
+                encoding.min_bitrate_bps = profile.minBitrate;
+                encoding.max_bitrate_bps = profile.maxBitrate;
+                encoding.max_framerate = profile.maxFramerate;
+                encoding.scale_resolution_down_by = profile.scaleResolutionDownBy;
+            }
             channel->send_channel()->SetRtpSendParameters(_ssrc, rtpParameters);
         });
     }
 
+    void OutgoingVideoChannel::setEncoding(const VideoEncodingProfile& newProfile) {
+        if (profile == newProfile) {
+            return;
+        }
+        const bool contentChanged = profile.speed != newProfile.speed || profile.lightweightCodec != newProfile.lightweightCodec;
+        const bool screencastChanged = profile.screencast != newProfile.screencast;
+        profile = newProfile;
+        if (contentChanged) {
+            applyContent();
+        }
+        if (screencastChanged) {
+            set_enabled(channel->enabled());
+        }
+        applyParameters();
+    }
+
+    void OutgoingVideoChannel::encoderStats(const std::function<void(const EncoderStats&)>& callback) const {
+        workerThread->PostTask(webrtc::SafeTask(workerSafety, [this, callback] {
+            EncoderStats stats;
+            cricket::VideoMediaSendInfo info;
+            if (channel->send_channel()->GetStats(&info)) {
+                for (const auto& sender : info.senders) {
+                    stats.framesEncoded += sender.frames_encoded;
+                    stats.totalEncodeTimeMs += static_cast<double>(sender.total_encode_time_ms);
+                }
+            }
+            callback(stats);
+        }));
+    }
+
+    void OutgoingVideoChannel::collectStats(CallStats& stats) const {
+        workerThread->BlockingCall([&] {
+            cricket::VideoMediaSendInfo info;
+            if (!channel->send_channel()->GetStats(&info)) {
+                return;
+            }
+            for (const auto& sender : info.senders) {
+                stats.framesEncoded += sender.frames_encoded;
+                stats.totalEncodeTimeMs += static_cast<double>(sender.total_encode_time_ms);
+                stats.fractionLost = std::max(stats.fractionLost, static_cast<double>(sender.fraction_lost));
+                if (sender.rtt_ms > 0) {
+                    stats.rttMs = std::max(stats.rttMs, static_cast<double>(sender.rtt_ms));
+                }
+            }
+        });
+    }
+
+    int OutgoingVideoChannel::complexity(const VideoEncodingProfile::Speed speed) {
+        switch (speed) {
+        case VideoEncodingProfile::Speed::Fast:
+            return static_cast<int>(webrtc::VideoCodecComplexity::kComplexityLow);
+        case VideoEncodingProfile::Speed::Quality:
+            return static_cast<int>(webrtc::VideoCodecComplexity::kComplexityHigh);
+        default:
+            return static_cast<int>(webrtc::VideoCodecComplexity::kComplexityNormal);
+        }
+    }
+
     OutgoingVideoChannel::~OutgoingVideoChannel() {
         channel->Enable(false);
         networkThread->BlockingCall([&] {
             channel->SetRtpTransport(nullptr);
         });
         workerThread->BlockingCall([&] {
+            workerSafety->SetNotAlive();
             channel = nullptr;
             bitrateAllocatorFactory = nullptr;
         });
@@ -121,7 +204,9 @@ namespace wrtc {
     void OutgoingVideoChannel::set_enabled(const bool enable) const {
         channel->Enable(enable);
         workerThread->BlockingCall([&] {
-            channel->send_channel()->SetVideoSend(_ssrc, nullptr, enable ? sink:nullptr);
+            cricket::VideoOptions videoOptions;
+            videoOptions.is_screencast = profile.screencast;
+            channel->send_channel()->SetVideoSend(_ssrc, &videoOptions, enable ? sink:nullptr);
         });
     }
 
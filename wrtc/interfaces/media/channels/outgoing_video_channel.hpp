@@ -3,9 +3,13 @@
 //
 
 #pragma once
+#include <api/task_queue/pending_task_safety_flag.h>
 #include <call/call.h>
 #include <pc/dtls_srtp_transport.h>
 
+#include "../../../models/call_stats.hpp"
+#include "../../../models/encoder_stats.hpp"
+#include "../../../models/encoding_profile.hpp"
 #include "../../../models/media_content.hpp"
 #include "../channel_manager.hpp"
 #include "wrtc/interfaces/media/local_video_adapter.hpp"
@@ -13,11 +17,20 @@
 namespace wrtc {
     class OutgoingVideoChannel final : public sigslot::has_slots<> {
         uint32_t _ssrc = 0;
+        MediaContent mediaContent;
+        VideoEncodingProfile profile;
         std::unique_ptr<cricket::VideoChannel> channel;
         rtc::Thread* workerThread;
         rtc::Thread* networkThread;
         std::unique_ptr<webrtc::VideoBitrateAllocatorFactory> bitrateAllocatorFactory;
         LocalVideoAdapter* sink;
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> workerSafety;
+
+        void applyContent() const;
+
+        void applyParameters() const;
+
+        static int complexity(VideoEncodingProfile::Speed speed);
 
     public:
         OutgoingVideoChannel(
@@ -25,6 +38,7 @@ namespace wrtc {
             ChannelManager* channelManager,
             webrtc::RtpTransport* rtpTransport,
             const MediaContent& mediaContent,
+            const VideoEncodingProfile& profile,
             rtc::Thread* workerThread,
             rtc::Thread* networkThread,
             LocalVideoAdapter* sink
@@ -34,6 +48,12 @@ namespace wrtc {
 
         void set_enabled(bool enable) const;
 
+        void setEncoding(const VideoEncodingProfile& newProfile);
+
+        void encoderStats(const std::function<void(const EncoderStats&)>& callback) const;
+
+        void collectStats(CallStats& stats) const;
+
         [[nodiscard]] uint32_t ssrc() const;
     };
 } // wrtc
\ No newline at end of file
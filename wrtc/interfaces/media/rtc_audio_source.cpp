@@ -7,17 +7,14 @@
 
 namespace wrtc {
     RTCAudioSource::RTCAudioSource() {
-        factory = PeerConnectionFactory::GetOrCreateDefault();
         source = new rtc::RefCountedObject<AudioTrackSource>();
     }
 
     RTCAudioSource::~RTCAudioSource() {
-        factory = nullptr;
         source = nullptr;
-        PeerConnectionFactory::UnRef();
     }
 
-    rtc::scoped_refptr<webrtc::AudioTrackInterface> RTCAudioSource::createTrack() const {
+    rtc::scoped_refptr<webrtc::AudioTrackInterface> RTCAudioSource::createTrack(const rtc::scoped_refptr<PeerConnectionFactory>& factory) const {
         return factory->factory()->CreateAudioTrack(rtc::CreateRandomUuid(), source.get());
     }
 
@@ -16,13 +16,12 @@ namespace wrtc {
 
         ~RTCAudioSource();
 
-        [[nodiscard]] rtc::scoped_refptr<webrtc::AudioTrackInterface> createTrack() const;
+        [[nodiscard]] rtc::scoped_refptr<webrtc::AudioTrackInterface> createTrack(const rtc::scoped_refptr<PeerConnectionFactory>& factory) const;
 
         void OnData(const RTCOnDataEvent &, int64_t absolute_capture_timestamp_ms) const;
 
     private:
         rtc::scoped_refptr<AudioTrackSource> source;
-        rtc::scoped_refptr<PeerConnectionFactory> factory;
     };
 
 } // wrtc
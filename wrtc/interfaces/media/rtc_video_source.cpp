@@ -7,23 +7,24 @@
 
 namespace wrtc {
     RTCVideoSource::RTCVideoSource() {
-        factory = PeerConnectionFactory::GetOrCreateDefault();
         source = new rtc::RefCountedObject<VideoTrackSource>();
     }
 
     RTCVideoSource::~RTCVideoSource() {
-        factory = nullptr;
         source = nullptr;
-        PeerConnectionFactory::UnRef();
     }
 
-    rtc::scoped_refptr<webrtc::VideoTrackInterface> RTCVideoSource::createTrack() const {
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> RTCVideoSource::createTrack(const rtc::scoped_refptr<PeerConnectionFactory>& factory) const {
         return factory->factory()->CreateVideoTrack(source, rtc::CreateRandomUuid());
     }
 
     void RTCVideoSource::OnFrame(const i420ImageData& data, const int64_t absolute_capture_timestamp_ms) const {
+        OnFrame(data.buffer(), absolute_capture_timestamp_ms);
+    }
+
+    void RTCVideoSource::OnFrame(const rtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer, const int64_t absolute_capture_timestamp_ms) const {
         source->PushFrame(webrtc::VideoFrame::Builder()
-            .set_video_frame_buffer(data.buffer())
+            .set_video_frame_buffer(buffer)
             .set_timestamp_rtp(0)
             .set_timestamp_ms(absolute_capture_timestamp_ms)
             .set_rotation(webrtc::kVideoRotation_0)
@@ -16,13 +16,14 @@ namespace wrtc {
 
         ~RTCVideoSource();
 
-        [[nodiscard]] rtc::scoped_refptr<webrtc::VideoTrackInterface> createTrack() const;
+        [[nodiscard]] rtc::scoped_refptr<webrtc::VideoTrackInterface> createTrack(const rtc::scoped_refptr<PeerConnectionFactory>& factory) const;
 
         void OnFrame(const i420ImageData& data, int64_t absolute_capture_timestamp_ms) const;
 
+        void OnFrame(const rtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer, int64_t absolute_capture_timestamp_ms) const;
+
     private:
         rtc::scoped_refptr<VideoTrackSource> source;
-        rtc::scoped_refptr<PeerConnectionFactory> factory;
     };
 
 } // wrtc
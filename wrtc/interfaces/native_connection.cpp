@@ -4,17 +4,18 @@
 
 #include "native_connection.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <api/enable_media.h>
 #include <p2p/base/p2p_constants.h>
 #include <rtc_base/crypto_random.h>
-#include <rtc_base/rtc_certificate_generator.h>
 #include <p2p/base/basic_async_resolver_factory.h>
 #include <p2p/base/p2p_transport_channel.h>
 #include <pc/media_factory.h>
 
 #include "reflector_relay_port_factory.hpp"
+#include "network/multiplexed_packet_socket_factory.hpp"
 #include "media/rtc_audio_source.hpp"
 #include "wrtc/exceptions.hpp"
 
@@ -25,6 +26,10 @@ namespace wrtc {
         const bool isOutgoing):
     isOutgoing(isOutgoing),
     enableP2P(enableP2P),
+    timerService(TimerService::GetOrCreateDefault()),
+    networkSafety(webrtc::PendingTaskSafetyFlag::CreateDetached()),
+    workerSafety(webrtc::PendingTaskSafetyFlag::CreateDetached()),
+    certificatePool(CertificatePool::GetOrCreateDefault()),
     rtcServers(std::move(rtcServers)),
     eventLog(std::make_unique<webrtc::RtcEventLogNull>()) {
         networkThread()->PostTask([this] {
@@ -33,10 +38,7 @@ namespace wrtc {
                 rtc::CreateRandomString(cricket::ICE_PWD_LENGTH),
                 true
             );
-            localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(
-                rtc::KeyParams(rtc::KT_ECDSA),
-                absl::nullopt
-            );
+            localCertificate = certificatePool->take();
             asyncResolverFactory = std::make_unique<webrtc::BasicAsyncDnsResolverFactory>();
             dtlsSrtpTransport = std::make_unique<webrtc::DtlsSrtpTransport>(true, factory->fieldTrials());
             dtlsSrtpTransport->SetDtlsTransports(nullptr, nullptr);
@@ -62,11 +64,11 @@ namespace wrtc {
             callConfig.audio_state = factory->mediaEngine()->voice().GetAudioState();
             call = factory->mediaFactory()->CreateCall(callConfig);
         });
-        contentNegotiationContext = std::make_unique<ContentNegotiationContext>(factory->fieldTrials(), isOutgoing, factory->mediaEngine(), factory->ssrcGenerator());
+        contentNegotiationContext = std::make_unique<ContentNegotiationContext>(factory->fieldTrials(), isOutgoing, factory->mediaEngine(), factory->ssrcGenerator(), certificatePool->placeholder());
         contentNegotiationContext->copyCodecsFromChannelManager(factory->mediaEngine(), false);
-        networkThread()->PostTask([this] {
+        networkThread()->PostTask(webrtc::SafeTask(networkSafety, [this] {
             start();
-        });
+        }));
     }
 
     void NativeConnection::resetDtlsSrtpTransport() {
@@ -79,10 +81,21 @@ namespace wrtc {
                 standaloneReflectorRoleId = 2;
             }
         }
-        relayPortFactory = std::make_unique<ReflectorRelayPortFactory>(rtcServers, standaloneReflectorMode, standaloneReflectorRoleId);
+        rtc::PacketSocketFactory* relaySocketFactory = nullptr;
+        if (const auto multiplexer = factory->socketMultiplexer()) {
+            if (!packetSocketFactory) {
+                packetSocketFactory = std::make_unique<MultiplexedPacketSocketFactory>(multiplexer, factory->socketFactory(), localParameters.ufrag);
+            }
+            relaySocketFactory = factory->socketFactory();
+        }
+        rtc::PacketSocketFactory* socketFactory = factory->socketFactory();
+        if (getCustomParameterBool("network_enable_batched_send")) {
+            socketFactory = factory->batchedSocketFactory();
+        }
+        relayPortFactory = std::make_unique<ReflectorRelayPortFactory>(rtcServers, standaloneReflectorMode, standaloneReflectorRoleId, relaySocketFactory);
         portAllocator = std::make_unique<cricket::BasicPortAllocator>(
             factory->networkManager(),
-            factory->socketFactory(),
+            packetSocketFactory ? packetSocketFactory.get() : socketFactory,
             nullptr,
             relayPortFactory.get()
         );
@@ -91,7 +104,9 @@ namespace wrtc {
             flags |= cricket::PORTALLOCATOR_DISABLE_ADAPTER_ENUMERATION;
         }
 
-        if (getCustomParameterBool("network_enable_shared_socket")) {
+        // A multiplexed connection must own a single UDP port, the shared socket
+        // routes incoming STUN by ufrag and only one port can claim each ufrag
+        if (packetSocketFactory || getCustomParameterBool("network_enable_shared_socket")) {
             flags |= cricket::PORTALLOCATOR_ENABLE_SHARED_SOCKET;
         }
         flags |= cricket::PORTALLOCATOR_ENABLE_IPV6;
@@ -110,7 +125,7 @@ namespace wrtc {
         cricket::ServerAddresses stunServers;
         std::vector<cricket::RelayServerConfig> turnServers;
         for (auto &[id, host, port, login, password, isTurn, isTcp] : rtcServers) {
-            if (isTcp) {
+            if (isTcp && !isTurn) {
                 continue;
             }
             if (isTurn) {
@@ -118,7 +133,7 @@ namespace wrtc {
                     rtc::SocketAddress(host, port),
                     login,
                     password,
-                    cricket::PROTO_UDP
+                    isTcp ? cricket::PROTO_TCP : cricket::PROTO_UDP
                 );
             } else {
                 auto stunAddress = rtc::SocketAddress(host, port);
@@ -182,7 +197,9 @@ namespace wrtc {
         if (audioChannelId) {
             if (const auto audioSsrc = contentNegotiationContext->outgoingChannelSsrc(*audioChannelId)) {
                 if (audioChannel && audioChannel->ssrc() != audioSsrc.value()) {
-                    audioChannel = nullptr;
+                    auto previousChannel = workerThread()->BlockingCall([&] {
+                        return std::move(audioChannel);
+                    });
                 }
                 std::optional<MediaContent> audioContent;
                 for (const auto &content : coordinatedState->outgoingContents) {
@@ -193,15 +210,19 @@ namespace wrtc {
                 }
                 if (audioContent) {
                     if (!audioChannel) {
-                        audioChannel = std::make_unique<OutgoingAudioChannel>(
+                        auto channel = std::make_unique<OutgoingAudioChannel>(
                             call.get(),
                             channelManager.get(),
                             dtlsSrtpTransport.get(),
                             *audioContent,
+                            audioEncoding,
                             workerThread(),
                             networkThread(),
                             &audioSink
                         );
+                        workerThread()->BlockingCall([&] {
+                            audioChannel = std::move(channel);
+                        });
                     }
                 }
             }
@@ -209,7 +230,9 @@ namespace wrtc {
         if (videoChannelId) {
             if (const auto videoSsrc = contentNegotiationContext->outgoingChannelSsrc(*videoChannelId)) {
                 if (videoChannel && videoChannel->ssrc() != videoSsrc.value()) {
-                    videoChannel = nullptr;
+                    auto previousChannel = workerThread()->BlockingCall([&] {
+                        return std::move(videoChannel);
+                    });
                 }
                 std::optional<MediaContent> videoContent;
                 for (const auto &content : coordinatedState->outgoingContents) {
@@ -220,15 +243,19 @@ namespace wrtc {
                 }
                 if (videoContent) {
                     if (!videoChannel) {
-                        videoChannel = std::make_unique<OutgoingVideoChannel>(
+                        auto channel = std::make_unique<OutgoingVideoChannel>(
                             call.get(),
                             channelManager.get(),
                             dtlsSrtpTransport.get(),
                             *videoContent,
+                            videoEncoding,
                             workerThread(),
                             networkThread(),
                             &videoSink
                         );
+                        workerThread()->BlockingCall([&] {
+                            videoChannel = std::move(channel);
+                        });
                     }
                 }
             }
@@ -266,6 +293,7 @@ namespace wrtc {
     // ReSharper disable once CppMemberFunctionMayBeConst
     void NativeConnection::candidateGathered(cricket::IceTransportInternal*, const cricket::Candidate& candidate) {
         assert(networkThread()->IsCurrent());
+        notifySetupMilestone(SetupMilestone::FirstCandidate);
         signalingThread()->PostTask([this, candidate] {
             cricket::Candidate patchedCandidate = candidate;
             patchedCandidate.set_component(1);
@@ -325,12 +353,15 @@ namespace wrtc {
             case webrtc::IceTransportState::kConnected:
             case webrtc::IceTransportState::kCompleted:
                 isConnected = true;
+                notifySetupMilestone(SetupMilestone::IceConnected);
                 break;
             default:
                 break;
         }
         if (!dtlsSrtpTransport->IsWritable(false)) {
             isConnected = false;
+        } else if (isConnected) {
+            notifySetupMilestone(SetupMilestone::DtlsConnected);
         }
         if (connected != isConnected) {
             connected = isConnected;
@@ -374,6 +405,28 @@ namespace wrtc {
 
     void NativeConnection::close() {
         isExiting = true;
+        if (factory) {
+            networkThread()->BlockingCall([&] {
+                networkSafety->SetNotAlive();
+                if (timeoutTimer) {
+                    timerService->cancel(timeoutTimer);
+                    timeoutTimer = 0;
+                }
+            });
+        }
+        if (timerService) {
+            timerService = nullptr;
+            TimerService::UnRef();
+        }
+        if (certificatePool) {
+            certificatePool = nullptr;
+            CertificatePool::UnRef();
+        }
+        if (factory) {
+            workerThread()->BlockingCall([&] {
+                workerSafety->SetNotAlive();
+            });
+        }
         audioChannel = nullptr;
         videoChannel = nullptr;
         channelManager = nullptr;
@@ -401,6 +454,7 @@ namespace wrtc {
                 dtlsTransport = nullptr;
                 transportChannel = nullptr;
                 portAllocator = nullptr;
+                packetSocketFactory = nullptr;
             });
         }
         NetworkInterface::close();
@@ -480,6 +534,92 @@ namespace wrtc {
         throw RTCException("Unsupported track type");
     }
 
+    void NativeConnection::setAudioEncoding(const AudioEncodingProfile& profile) {
+        audioEncoding = profile;
+        if (audioChannel != nullptr) {
+            audioChannel->setEncoding(profile);
+        }
+    }
+
+    void NativeConnection::setVideoEncoding(const VideoEncodingProfile& profile) {
+        videoEncoding = profile;
+        if (videoChannel != nullptr) {
+            videoChannel->setEncoding(profile);
+        }
+    }
+
+    void NativeConnection::encoderStats(const std::function<void(const EncoderStats&)>& callback) const {
+        if (videoChannel == nullptr) {
+            callback({});
+            return;
+        }
+        videoChannel->encoderStats(callback);
+    }
+
+    CallStats NativeConnection::stats() const {
+        CallStats stats;
+        networkThread()->BlockingCall([&] {
+            cricket::IceTransportStats transportStats;
+            if (!transportChannel || !transportChannel->GetStats(&transportStats)) {
+                return;
+            }
+            stats.bytesSent = transportStats.bytes_sent;
+            stats.bytesReceived = transportStats.bytes_received;
+            stats.packetsSent = transportStats.packets_sent;
+            stats.packetsReceived = transportStats.packets_received;
+            for (const auto& info : transportStats.connection_infos) {
+                if (!info.best_connection) {
+                    continue;
+                }
+                stats.rttMs = static_cast<double>(info.rtt);
+                stats.candidatePair = CandidatePairStats{
+                    info.local_candidate.address().ToString(),
+                    info.local_candidate.type_name(),
+                    info.remote_candidate.address().ToString(),
+                    info.remote_candidate.type_name(),
+                    info.local_candidate.protocol(),
+                };
+            }
+        });
+        if (call) {
+            workerThread()->BlockingCall([&] {
+                const auto callStats = call->GetStats();
+                stats.sendBandwidth = callStats.send_bandwidth_bps;
+                stats.recvBandwidth = callStats.recv_bandwidth_bps;
+            });
+        }
+        if (audioChannel != nullptr) {
+            audioChannel->collectStats(stats);
+        }
+        if (videoChannel != nullptr) {
+            videoChannel->collectStats(stats);
+        }
+        return stats;
+    }
+
+    void NativeConnection::bandwidthStats(const std::function<void(const BandwidthStats&)>& callback) const {
+        workerThread()->PostTask(webrtc::SafeTask(workerSafety, [this, callback] {
+            BandwidthStats stats;
+            if (call) {
+                const auto callStats = call->GetStats();
+                stats.sendBandwidth = callStats.send_bandwidth_bps;
+                stats.rttMs = static_cast<double>(std::max<int64_t>(callStats.rtt_ms, 0));
+            }
+            CallStats senderStats;
+            if (audioChannel != nullptr) {
+                audioChannel->collectStats(senderStats);
+            }
+            if (videoChannel != nullptr) {
+                videoChannel->collectStats(senderStats);
+            }
+            stats.fractionLost = senderStats.fractionLost;
+            if (!stats.rttMs) {
+                stats.rttMs = senderStats.rttMs;
+            }
+            callback(stats);
+        }));
+    }
+
     std::unique_ptr<rtc::SSLFingerprint> NativeConnection::localFingerprint() const {
         const auto certificate = localCertificate;
         if (!certificate) {
@@ -493,16 +633,22 @@ namespace wrtc {
     }
 
     void NativeConnection::checkConnectionTimeout() {
-        networkThread()->PostDelayedTask([this] {
-            if (isExiting) return;
-            const int64_t currentTimestamp = rtc::TimeMillis();
-            if (constexpr int64_t maxTimeout = 20000; !connected && lastDisconnectedTimestamp + maxTimeout < currentTimestamp) {
-                RTC_LOG(LS_INFO) << "NativeNetworkingImpl timeout " << currentTimestamp - lastDisconnectedTimestamp << " ms";
-                failed = true;
-                notifyStateUpdated();
-                return;
-            }
-            checkConnectionTimeout();
-        }, webrtc::TimeDelta::Millis(1000));
+        assert(networkThread()->IsCurrent());
+        if (timeoutTimer) {
+            timerService->cancel(timeoutTimer);
+        }
+        timeoutTimer = timerService->schedulePeriodic(webrtc::TimeDelta::Millis(1000), [this] {
+            if (isExiting) return false;
+            networkThread()->PostTask(webrtc::SafeTask(networkSafety, [this] {
+                const int64_t currentTimestamp = rtc::TimeMillis();
+                if (constexpr int64_t maxTimeout = 20000; !connected && lastDisconnectedTimestamp + maxTimeout < currentTimestamp) {
+                    RTC_LOG(LS_INFO) << "NativeNetworkingImpl timeout " << currentTimestamp - lastDisconnectedTimestamp << " ms";
+                    failed = true;
+                    timerService->cancel(std::exchange(timeoutTimer, 0));
+                    notifyStateUpdated();
+                }
+            }));
+            return true;
+        });
     }
 } // wrtc
\ No newline at end of file
@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include <api/task_queue/pending_task_safety_flag.h>
 #include <p2p/base/p2p_transport_channel.h>
 #include <p2p/client/basic_port_allocator.h>
 #include <p2p/client/relay_port_factory_interface.h>
@@ -25,6 +26,8 @@
 
 #include "wrtc/models/connection_description.hpp"
 #include "wrtc/models/route_description.hpp"
+#include "wrtc/utils/certificate_pool.hpp"
+#include "wrtc/utils/timer_service.hpp"
 
 namespace wrtc {
     using nlohmann::json;
@@ -35,11 +38,19 @@ namespace wrtc {
         std::atomic_bool isExiting;
         bool isOutgoing, enableP2P;
         int64_t lastDisconnectedTimestamp = 0;
+        rtc::scoped_refptr<TimerService> timerService;
+        // Network thread only
+        TimerService::TimerId timeoutTimer = 0;
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> networkSafety;
+        // Worker tasks read the outgoing channels, they are swapped on that thread
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> workerSafety;
+        rtc::scoped_refptr<CertificatePool> certificatePool;
         std::vector<RTCServer> rtcServers;
         PeerIceParameters localParameters, remoteParameters;
         rtc::scoped_refptr<rtc::RTCCertificate> localCertificate;
         std::unique_ptr<cricket::DtlsTransport> dtlsTransport;
         std::unique_ptr<webrtc::DtlsSrtpTransport> dtlsSrtpTransport;
+        std::unique_ptr<rtc::PacketSocketFactory> packetSocketFactory;
         std::unique_ptr<cricket::RelayPortFactoryInterface> relayPortFactory;
         std::unique_ptr<cricket::BasicPortAllocator> portAllocator;
         std::unique_ptr<webrtc::AsyncDnsResolverFactoryInterface> asyncResolverFactory;
@@ -54,6 +65,8 @@ namespace wrtc {
         std::unique_ptr<ChannelManager> channelManager;
         std::unique_ptr<OutgoingAudioChannel> audioChannel;
         std::unique_ptr<OutgoingVideoChannel> videoChannel;
+        AudioEncodingProfile audioEncoding;
+        VideoEncodingProfile videoEncoding;
         webrtc::LocalAudioSinkAdapter audioSink;
         LocalVideoAdapter videoSink;
 
@@ -108,6 +121,16 @@ namespace wrtc {
 
         std::unique_ptr<MediaTrackInterface> addTrack(const rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>& track) override;
 
+        void setAudioEncoding(const AudioEncodingProfile& profile) override;
+
+        void setVideoEncoding(const VideoEncodingProfile& profile) override;
+
+        void encoderStats(const std::function<void(const EncoderStats&)>& callback) const override;
+
+        CallStats stats() const override;
+
+        void bandwidthStats(const std::function<void(const BandwidthStats&)>& callback) const override;
+
         std::unique_ptr<rtc::SSLFingerprint> localFingerprint() const;
 
         PeerIceParameters localIceParameters();
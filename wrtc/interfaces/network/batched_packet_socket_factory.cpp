@@ -0,0 +1,20 @@
+//
+// Created by Laky64 on 18/09/2024.
+//
+
+#include "batched_packet_socket_factory.hpp"
+
+#ifdef IS_LINUX
+#include "batched_udp_socket.hpp"
+
+namespace wrtc {
+    BatchedPacketSocketFactory::BatchedPacketSocketFactory(rtc::PhysicalSocketServer* server): BasicPacketSocketFactory(server), server(server) {}
+
+    rtc::AsyncPacketSocket* BatchedPacketSocketFactory::CreateUdpSocket(const rtc::SocketAddress& address, const uint16_t minPort, const uint16_t maxPort) {
+        if (auto socket = BatchedUdpSocket::Create(server, address, minPort, maxPort)) {
+            return socket.release();
+        }
+        return BasicPacketSocketFactory::CreateUdpSocket(address, minPort, maxPort);
+    }
+} // wrtc
+#endif
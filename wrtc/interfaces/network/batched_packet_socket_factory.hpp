@@ -0,0 +1,23 @@
+//
+// Created by Laky64 on 18/09/2024.
+//
+
+#pragma once
+
+#ifdef IS_LINUX
+#include <p2p/base/basic_packet_socket_factory.h>
+#include <rtc_base/physical_socket_server.h>
+
+namespace wrtc {
+
+    class BatchedPacketSocketFactory final : public rtc::BasicPacketSocketFactory {
+        rtc::PhysicalSocketServer* server;
+
+    public:
+        explicit BatchedPacketSocketFactory(rtc::PhysicalSocketServer* server);
+
+        rtc::AsyncPacketSocket* CreateUdpSocket(const rtc::SocketAddress& address, uint16_t minPort, uint16_t maxPort) override;
+    };
+
+} // wrtc
+#endif
@@ -0,0 +1,445 @@
+//
+// Created by Laky64 on 18/09/2024.
+//
+
+#include "batched_udp_socket.hpp"
+
+#ifdef IS_LINUX
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <rtc_base/logging.h>
+#include <rtc_base/time_utils.h>
+#include <rtc_base/network/received_packet.h>
+#include <rtc_base/network/sent_packet.h>
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+namespace wrtc {
+    namespace {
+        constexpr size_t ReceiveBatch = 16;
+        constexpr size_t ReceiveBufferSize = 65536;
+        constexpr size_t MaxReceiveRounds = 4;
+
+        template <typename T>
+        struct alignas(cmsghdr) Control {
+            uint8_t data[CMSG_SPACE(sizeof(T))];
+        };
+
+        // Receive buffers are shared by every socket of the same network thread,
+        // events are dispatched one at a time so they are never used concurrently.
+        struct ReceiveArena {
+            std::vector<uint8_t> buffers = std::vector<uint8_t>(ReceiveBatch * ReceiveBufferSize);
+            std::array<mmsghdr, ReceiveBatch> messages{};
+            std::array<iovec, ReceiveBatch> iovecs{};
+            std::array<sockaddr_storage, ReceiveBatch> addresses{};
+            std::array<Control<int>, ReceiveBatch> controls{};
+        };
+
+        ReceiveArena& receiveArena() {
+            static thread_local ReceiveArena arena;
+            return arena;
+        }
+    }
+
+    BatchedUdpSocket::BatchedUdpSocket(rtc::PhysicalSocketServer* server, const int fd, const rtc::SocketAddress& localAddress, const bool gsoSupported):
+        server(server), thread(rtc::Thread::Current()), fd(fd), localAddress(localAddress), gsoSupported(gsoSupported) {
+        server->Add(this);
+    }
+
+    BatchedUdpSocket::~BatchedUdpSocket() {
+        BatchedUdpSocket::Close();
+    }
+
+    std::unique_ptr<BatchedUdpSocket> BatchedUdpSocket::Create(rtc::PhysicalSocketServer* server, const rtc::SocketAddress& address, const uint16_t minPort, const uint16_t maxPort) {
+        const int fd = socket(address.family(), SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+        if (fd < 0) {
+            RTC_LOG(LS_WARNING) << "Failed to create batched UDP socket: " << errno;
+            return nullptr;
+        }
+        const auto tryBind = [fd](const rtc::SocketAddress& bindAddress) {
+            sockaddr_storage storage{};
+            const auto length = bindAddress.ToSockAddrStorage(&storage);
+            return length > 0 && bind(fd, reinterpret_cast<sockaddr*>(&storage), static_cast<socklen_t>(length)) == 0;
+        };
+        bool bound = false;
+        if (minPort == 0 && maxPort == 0) {
+            bound = tryBind(address);
+        } else {
+            for (uint32_t port = minPort; !bound && port <= maxPort; port++) {
+                bound = tryBind(rtc::SocketAddress(address.ipaddr(), static_cast<int>(port)));
+            }
+        }
+        if (!bound) {
+            close(fd);
+            return nullptr;
+        }
+        constexpr int enable = 1;
+        setsockopt(fd, SOL_UDP, UDP_GRO, &enable, sizeof(enable));
+        int segmentSize = 0;
+        socklen_t segmentLength = sizeof(segmentSize);
+        const bool gsoSupported = getsockopt(fd, SOL_UDP, UDP_SEGMENT, &segmentSize, &segmentLength) == 0;
+
+        sockaddr_storage local{};
+        socklen_t localLength = sizeof(local);
+        rtc::SocketAddress localAddress;
+        if (getsockname(fd, reinterpret_cast<sockaddr*>(&local), &localLength) == 0) {
+            rtc::SocketAddressFromSockAddrStorage(local, &localAddress);
+        }
+        return std::unique_ptr<BatchedUdpSocket>(new BatchedUdpSocket(server, fd, localAddress, gsoSupported));
+    }
+
+    rtc::SocketAddress BatchedUdpSocket::GetLocalAddress() const {
+        return localAddress;
+    }
+
+    rtc::SocketAddress BatchedUdpSocket::GetRemoteAddress() const {
+        return {};
+    }
+
+    int BatchedUdpSocket::Send(const void*, size_t, const rtc::PacketOptions&) {
+        error = ENOTCONN;
+        return -1;
+    }
+
+    int BatchedUdpSocket::SendTo(const void* data, const size_t size, const rtc::SocketAddress& address, const rtc::PacketOptions& options) {
+        if (fd < 0) {
+            error = EBADF;
+            return -1;
+        }
+        if (sendError) {
+            error = std::exchange(sendError, 0);
+            return -1;
+        }
+        if (blocked) {
+            error = EWOULDBLOCK;
+            return -1;
+        }
+        sockaddr_storage storage{};
+        const auto addressLength = toSockAddr(address, &storage);
+        if (!addressLength) {
+            error = EINVAL;
+            return -1;
+        }
+        if (options.dscp != rtc::DSCP_NO_CHANGE && options.dscp != dscp) {
+            // Queued packets must leave with the DSCP they were sent with
+            const auto flag = safety.flag();
+            flush();
+            if (!flag->alive()) {
+                return -1;
+            }
+            if (blocked) {
+                error = EWOULDBLOCK;
+                return -1;
+            }
+            if (SetOption(rtc::Socket::OPT_DSCP, options.dscp) < 0) {
+                return -1;
+            }
+        }
+        if (!pendingCount && !flushScheduled) {
+            // Nothing to batch with, the first packet of a task goes out at once
+            // and the ones following it in the same task are batched
+            if (sendto(fd, data, size, 0, reinterpret_cast<sockaddr*>(&storage), addressLength) < 0) {
+                error = errno;
+                if (error == EAGAIN || error == EWOULDBLOCK) {
+                    setBlocked(true);
+                }
+                return -1;
+            }
+            flushScheduled = true;
+            thread->PostTask(webrtc::SafeTask(safety.flag(), [this] {
+                flushScheduled = false;
+                flush();
+            }));
+            SignalSentPacket(this, rtc::SentPacket(options.packet_id, rtc::TimeMillis(), options.info_signaled_after_sent));
+            return static_cast<int>(size);
+        }
+        if (pending.size() == pendingCount) {
+            pending.emplace_back();
+        }
+        auto& packet = pending[pendingCount++];
+        packet.address = storage;
+        packet.addressLength = addressLength;
+        packet.data.SetData(static_cast<const uint8_t*>(data), size);
+        packet.packetId = options.packet_id;
+        packet.info = options.info_signaled_after_sent;
+        if (pendingCount >= MaxBatch) {
+            flush();
+        }
+        return static_cast<int>(size);
+    }
+
+    int BatchedUdpSocket::Close() {
+        if (fd < 0) {
+            return 0;
+        }
+        server->Remove(this);
+        close(fd);
+        fd = -1;
+        pendingCount = 0;
+        sendError = 0;
+        return 0;
+    }
+
+    rtc::AsyncPacketSocket::State BatchedUdpSocket::GetState() const {
+        return fd >= 0 ? STATE_BOUND : STATE_CLOSED;
+    }
+
+    int BatchedUdpSocket::GetOption(const rtc::Socket::Option opt, int* value) {
+        if (const auto it = options.find(opt); it != options.end()) {
+            *value = it->second;
+            return 0;
+        }
+        return -1;
+    }
+
+    int BatchedUdpSocket::SetOption(const rtc::Socket::Option opt, const int value) {
+        const bool ipv6 = localAddress.family() == AF_INET6;
+        int level = SOL_SOCKET, name, optionValue = value;
+        switch (opt) {
+        case rtc::Socket::OPT_RCVBUF:
+            name = SO_RCVBUF;
+            break;
+        case rtc::Socket::OPT_SNDBUF:
+            name = SO_SNDBUF;
+            break;
+        case rtc::Socket::OPT_DONTFRAGMENT:
+            level = ipv6 ? IPPROTO_IPV6 : IPPROTO_IP;
+            name = ipv6 ? IPV6_MTU_DISCOVER : IP_MTU_DISCOVER;
+            optionValue = value ? IP_PMTUDISC_DO : IP_PMTUDISC_DONT;
+            break;
+        case rtc::Socket::OPT_DSCP:
+            level = ipv6 ? IPPROTO_IPV6 : IPPROTO_IP;
+            name = ipv6 ? IPV6_TCLASS : IP_TOS;
+            optionValue = value << 2;
+            break;
+        case rtc::Socket::OPT_RTP_SENDTIME_EXTN_ID:
+            options[opt] = value;
+            return 0;
+        default:
+            error = ENOTSUP;
+            return -1;
+        }
+        if (setsockopt(fd, level, name, &optionValue, sizeof(optionValue)) < 0) {
+            error = errno;
+            return -1;
+        }
+        if (opt == rtc::Socket::OPT_DSCP) {
+            dscp = value;
+        }
+        options[opt] = value;
+        return 0;
+    }
+
+    int BatchedUdpSocket::GetError() const {
+        return error;
+    }
+
+    void BatchedUdpSocket::SetError(const int newError) {
+        error = newError;
+    }
+
+    uint32_t BatchedUdpSocket::GetRequestedEvents() {
+        return rtc::DE_READ | (blocked ? rtc::DE_WRITE : 0);
+    }
+
+    void BatchedUdpSocket::OnEvent(const uint32_t ff, int) {
+        const auto flag = safety.flag();
+        if (ff & rtc::DE_READ) {
+            receive();
+            if (!flag->alive()) {
+                return;
+            }
+        }
+        if (ff & rtc::DE_WRITE && fd >= 0) {
+            setBlocked(false);
+            flush();
+            if (flag->alive() && !blocked) {
+                SignalReadyToSend(this);
+            }
+        }
+    }
+
+    int BatchedUdpSocket::GetDescriptor() {
+        return fd;
+    }
+
+    bool BatchedUdpSocket::IsDescriptorClosed() {
+        return fd < 0;
+    }
+
+    socklen_t BatchedUdpSocket::toSockAddr(const rtc::SocketAddress& address, sockaddr_storage* storage) const {
+        if (address.IsUnresolvedIP()) {
+            return 0;
+        }
+        if (localAddress.family() == AF_INET6 && address.family() == AF_INET) {
+            return static_cast<socklen_t>(rtc::SocketAddress(address.ipaddr().AsIPv6Address(), address.port()).ToSockAddrStorage(storage));
+        }
+        return static_cast<socklen_t>(address.ToSockAddrStorage(storage));
+    }
+
+    void BatchedUdpSocket::flush() {
+        const auto flag = safety.flag();
+        size_t sentPackets = 0;
+        while (fd >= 0 && !blocked && sentPackets < pendingCount) {
+            std::array<mmsghdr, MaxBatch> messages{};
+            std::array<iovec, MaxBatch> iovecs{};
+            std::array<Control<uint16_t>, MaxBatch> controls{};
+            std::array<size_t, MaxBatch> messagePackets{};
+            size_t messageCount = 0, segmentSize = 0, messageBytes = 0;
+            const size_t end = std::min(pendingCount, sentPackets + MaxBatch);
+            for (size_t i = sentPackets; i < end; i++) {
+                auto& packet = pending[i];
+                auto& iov = iovecs[i - sentPackets];
+                iov.iov_base = packet.data.data();
+                iov.iov_len = packet.data.size();
+                if (messageCount > 0) {
+                    const auto& first = pending[i - messagePackets[messageCount - 1]];
+                    if (gsoSupported &&
+                        packet.addressLength == first.addressLength &&
+                        memcmp(&packet.address, &first.address, packet.addressLength) == 0 &&
+                        pending[i - 1].data.size() == segmentSize &&
+                        packet.data.size() <= segmentSize &&
+                        messagePackets[messageCount - 1] < MaxSegments &&
+                        messageBytes + packet.data.size() <= MaxGsoSize
+                    ) {
+                        messages[messageCount - 1].msg_hdr.msg_iovlen++;
+                        messagePackets[messageCount - 1]++;
+                        messageBytes += packet.data.size();
+                        continue;
+                    }
+                }
+                auto& header = messages[messageCount].msg_hdr;
+                header.msg_name = &packet.address;
+                header.msg_namelen = packet.addressLength;
+                header.msg_iov = &iov;
+                header.msg_iovlen = 1;
+                messagePackets[messageCount] = 1;
+                segmentSize = packet.data.size();
+                messageBytes = segmentSize;
+                messageCount++;
+            }
+            for (size_t m = 0; m < messageCount; m++) {
+                if (messagePackets[m] < 2) {
+                    continue;
+                }
+                auto& header = messages[m].msg_hdr;
+                header.msg_control = controls[m].data;
+                header.msg_controllen = sizeof(controls[m].data);
+                auto* cmsg = CMSG_FIRSTHDR(&header);
+                cmsg->cmsg_level = SOL_UDP;
+                cmsg->cmsg_type = UDP_SEGMENT;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const auto size = static_cast<uint16_t>(header.msg_iov[0].iov_len);
+                memcpy(CMSG_DATA(cmsg), &size, sizeof(size));
+            }
+
+            const int result = sendmmsg(fd, messages.data(), static_cast<unsigned int>(messageCount), 0);
+            if (result < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    setBlocked(true);
+                    break;
+                }
+                if (errno == EIO && messagePackets[0] > 1) {
+                    RTC_LOG(LS_WARNING) << "UDP GSO rejected by the kernel, falling back to sendmmsg only";
+                    gsoSupported = false;
+                    continue;
+                }
+                error = sendError = errno;
+                RTC_LOG(LS_VERBOSE) << "sendmmsg failed, dropping " << messagePackets[0] << " packets: " << errno;
+                sentPackets += messagePackets[0];
+                continue;
+            }
+            const auto now = rtc::TimeMillis();
+            for (int m = 0; m < result; m++) {
+                for (size_t p = 0; p < messagePackets[m]; p++) {
+                    const auto& packet = pending[sentPackets++];
+                    SignalSentPacket(this, rtc::SentPacket(packet.packetId, now, packet.info));
+                    if (!flag->alive()) {
+                        return;
+                    }
+                }
+            }
+        }
+        std::rotate(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(sentPackets), pending.begin() + static_cast<std::ptrdiff_t>(pendingCount));
+        pendingCount -= sentPackets;
+    }
+
+    void BatchedUdpSocket::receive() {
+        auto& arena = receiveArena();
+        const auto flag = safety.flag();
+        for (size_t round = 0; round < MaxReceiveRounds; round++) {
+            for (size_t i = 0; i < ReceiveBatch; i++) {
+                arena.iovecs[i].iov_base = arena.buffers.data() + i * ReceiveBufferSize;
+                arena.iovecs[i].iov_len = ReceiveBufferSize;
+                auto& header = arena.messages[i].msg_hdr;
+                header = {};
+                header.msg_name = &arena.addresses[i];
+                header.msg_namelen = sizeof(sockaddr_storage);
+                header.msg_iov = &arena.iovecs[i];
+                header.msg_iovlen = 1;
+                header.msg_control = arena.controls[i].data;
+                header.msg_controllen = sizeof(arena.controls[i].data);
+                arena.messages[i].msg_len = 0;
+            }
+            const int count = recvmmsg(fd, arena.messages.data(), ReceiveBatch, MSG_DONTWAIT, nullptr);
+            if (count <= 0) {
+                if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                    error = errno;
+                }
+                return;
+            }
+            const auto now = webrtc::Timestamp::Micros(rtc::TimeMicros());
+            for (int i = 0; i < count; i++) {
+                auto& header = arena.messages[i].msg_hdr;
+                const size_t length = arena.messages[i].msg_len;
+                size_t segmentSize = length;
+                for (auto* cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = CMSG_NXTHDR(&header, cmsg)) {
+                    if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+                        int groSize = 0;
+                        memcpy(&groSize, CMSG_DATA(cmsg), sizeof(groSize));
+                        if (groSize > 0) {
+                            segmentSize = static_cast<size_t>(groSize);
+                        }
+                    }
+                }
+                rtc::SocketAddress source;
+                rtc::SocketAddressFromSockAddrStorage(arena.addresses[i], &source);
+                const uint8_t* data = arena.buffers.data() + i * ReceiveBufferSize;
+                for (size_t offset = 0; offset < length; offset += segmentSize) {
+                    NotifyPacketReceived(rtc::ReceivedPacket(
+                        rtc::MakeArrayView(data + offset, std::min(segmentSize, length - offset)),
+                        source,
+                        now
+                    ));
+                    if (!flag->alive() || fd < 0) {
+                        return;
+                    }
+                }
+            }
+            if (static_cast<size_t>(count) < ReceiveBatch) {
+                return;
+            }
+        }
+    }
+
+    void BatchedUdpSocket::setBlocked(const bool value) {
+        if (blocked == value) {
+            return;
+        }
+        blocked = value;
+        server->Update(this);
+    }
+} // wrtc
+#endif
@@ -0,0 +1,99 @@
+//
+// Created by Laky64 on 18/09/2024.
+//
+
+#pragma once
+
+#ifdef IS_LINUX
+#include <map>
+#include <vector>
+#include <netinet/in.h>
+#include <api/task_queue/pending_task_safety_flag.h>
+#include <rtc_base/async_packet_socket.h>
+#include <rtc_base/buffer.h>
+#include <rtc_base/physical_socket_server.h>
+#include <rtc_base/thread.h>
+
+namespace wrtc {
+
+    // UDP socket driven directly by the network thread's socket server.
+    // The first packet of a task is sent at once, the ones following it are
+    // flushed together at the end of the task with a single sendmmsg (coalescing
+    // same-sized runs with UDP_SEGMENT when the kernel supports it), incoming
+    // ones are drained with recvmmsg and UDP_GRO. A failed batch is reported by
+    // the next SendTo.
+    class BatchedUdpSocket final : public rtc::AsyncPacketSocket, public rtc::Dispatcher {
+    public:
+        static std::unique_ptr<BatchedUdpSocket> Create(rtc::PhysicalSocketServer* server, const rtc::SocketAddress& address, uint16_t minPort, uint16_t maxPort);
+
+        ~BatchedUdpSocket() override;
+
+        rtc::SocketAddress GetLocalAddress() const override;
+
+        rtc::SocketAddress GetRemoteAddress() const override;
+
+        int Send(const void* data, size_t size, const rtc::PacketOptions& options) override;
+
+        int SendTo(const void* data, size_t size, const rtc::SocketAddress& address, const rtc::PacketOptions& options) override;
+
+        int Close() override;
+
+        State GetState() const override;
+
+        int GetOption(rtc::Socket::Option opt, int* value) override;
+
+        int SetOption(rtc::Socket::Option opt, int value) override;
+
+        int GetError() const override;
+
+        void SetError(int error) override;
+
+        uint32_t GetRequestedEvents() override;
+
+        void OnEvent(uint32_t ff, int err) override;
+
+        int GetDescriptor() override;
+
+        bool IsDescriptorClosed() override;
+
+    private:
+        static constexpr size_t MaxBatch = 64;
+        static constexpr size_t MaxSegments = 64;
+        static constexpr size_t MaxGsoSize = 65000;
+
+        struct PendingPacket {
+            rtc::Buffer data;
+            sockaddr_storage address{};
+            socklen_t addressLength = 0;
+            int64_t packetId = -1;
+            rtc::PacketInfo info;
+        };
+
+        rtc::PhysicalSocketServer* server;
+        rtc::Thread* thread;
+        int fd;
+        rtc::SocketAddress localAddress;
+        bool gsoSupported;
+        bool blocked = false;
+        bool flushScheduled = false;
+        int error = 0;
+        int sendError = 0;
+        int dscp = rtc::DSCP_DEFAULT;
+        std::map<rtc::Socket::Option, int> options;
+        std::vector<PendingPacket> pending;
+        size_t pendingCount = 0;
+        webrtc::ScopedTaskSafety safety;
+
+        BatchedUdpSocket(rtc::PhysicalSocketServer* server, int fd, const rtc::SocketAddress& localAddress, bool gsoSupported);
+
+        socklen_t toSockAddr(const rtc::SocketAddress& address, sockaddr_storage* storage) const;
+
+        void flush();
+
+        void receive();
+
+        void setBlocked(bool value);
+    };
+
+} // wrtc
+#endif
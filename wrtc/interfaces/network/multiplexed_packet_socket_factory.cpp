@@ -0,0 +1,26 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#include "multiplexed_packet_socket_factory.hpp"
+
+namespace wrtc {
+    MultiplexedPacketSocketFactory::MultiplexedPacketSocketFactory(SocketMultiplexer* multiplexer, rtc::PacketSocketFactory* socketFactory, std::string ufrag):
+        multiplexer(multiplexer), socketFactory(socketFactory), ufrag(std::move(ufrag)) {}
+
+    rtc::AsyncPacketSocket* MultiplexedPacketSocketFactory::CreateUdpSocket(const rtc::SocketAddress& address, const uint16_t minPort, const uint16_t maxPort) {
+        return multiplexer->createUdpSocket(address, minPort, maxPort, ufrag);
+    }
+
+    rtc::AsyncListenSocket* MultiplexedPacketSocketFactory::CreateServerTcpSocket(const rtc::SocketAddress& localAddress, const uint16_t minPort, const uint16_t maxPort, const int opts) {
+        return socketFactory->CreateServerTcpSocket(localAddress, minPort, maxPort, opts);
+    }
+
+    rtc::AsyncPacketSocket* MultiplexedPacketSocketFactory::CreateClientTcpSocket(const rtc::SocketAddress& localAddress, const rtc::SocketAddress& remoteAddress, const rtc::ProxyInfo& proxyInfo, const std::string& userAgent, const rtc::PacketSocketTcpOptions& tcpOptions) {
+        return socketFactory->CreateClientTcpSocket(localAddress, remoteAddress, proxyInfo, userAgent, tcpOptions);
+    }
+
+    std::unique_ptr<webrtc::AsyncDnsResolverInterface> MultiplexedPacketSocketFactory::CreateAsyncDnsResolver() {
+        return socketFactory->CreateAsyncDnsResolver();
+    }
+} // wrtc
@@ -0,0 +1,30 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#pragma once
+
+#include <api/packet_socket_factory.h>
+
+#include "socket_multiplexer.hpp"
+
+namespace wrtc {
+
+    class MultiplexedPacketSocketFactory final : public rtc::PacketSocketFactory {
+        SocketMultiplexer* multiplexer;
+        rtc::PacketSocketFactory* socketFactory;
+        std::string ufrag;
+
+    public:
+        MultiplexedPacketSocketFactory(SocketMultiplexer* multiplexer, rtc::PacketSocketFactory* socketFactory, std::string ufrag);
+
+        rtc::AsyncPacketSocket* CreateUdpSocket(const rtc::SocketAddress& address, uint16_t minPort, uint16_t maxPort) override;
+
+        rtc::AsyncListenSocket* CreateServerTcpSocket(const rtc::SocketAddress& localAddress, uint16_t minPort, uint16_t maxPort, int opts) override;
+
+        rtc::AsyncPacketSocket* CreateClientTcpSocket(const rtc::SocketAddress& localAddress, const rtc::SocketAddress& remoteAddress, const rtc::ProxyInfo& proxyInfo, const std::string& userAgent, const rtc::PacketSocketTcpOptions& tcpOptions) override;
+
+        std::unique_ptr<webrtc::AsyncDnsResolverInterface> CreateAsyncDnsResolver() override;
+    };
+
+} // wrtc
@@ -0,0 +1,82 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#include "multiplexed_udp_socket.hpp"
+
+#include <cerrno>
+#include <rtc_base/time_utils.h>
+#include <rtc_base/network/sent_packet.h>
+
+#include "shared_udp_socket.hpp"
+
+namespace wrtc {
+    MultiplexedUdpSocket::MultiplexedUdpSocket(SharedUdpSocket* shared, const std::string& ufrag): shared(shared) {
+        shared->attach(this, ufrag);
+    }
+
+    MultiplexedUdpSocket::~MultiplexedUdpSocket() {
+        MultiplexedUdpSocket::Close();
+    }
+
+    void MultiplexedUdpSocket::deliver(const rtc::ReceivedPacket& packet) {
+        NotifyPacketReceived(packet);
+    }
+
+    rtc::SocketAddress MultiplexedUdpSocket::GetLocalAddress() const {
+        return shared ? shared->packetSocket()->GetLocalAddress() : rtc::SocketAddress();
+    }
+
+    rtc::SocketAddress MultiplexedUdpSocket::GetRemoteAddress() const {
+        return {};
+    }
+
+    int MultiplexedUdpSocket::Send(const void*, size_t, const rtc::PacketOptions&) {
+        error = ENOTCONN;
+        return -1;
+    }
+
+    int MultiplexedUdpSocket::SendTo(const void* data, const size_t size, const rtc::SocketAddress& address, const rtc::PacketOptions& options) {
+        if (!shared) {
+            error = EBADF;
+            return -1;
+        }
+        const int result = shared->sendTo(this, data, size, address, options);
+        if (result < 0) {
+            error = shared->packetSocket()->GetError();
+            return result;
+        }
+        rtc::SentPacket sentPacket(options.packet_id, rtc::TimeMillis(), options.info_signaled_after_sent);
+        CopySocketInformationToPacketInfo(size, *this, false, &sentPacket.info);
+        SignalSentPacket(this, sentPacket);
+        return result;
+    }
+
+    int MultiplexedUdpSocket::Close() {
+        if (shared) {
+            shared->detach(this);
+            shared = nullptr;
+        }
+        return 0;
+    }
+
+    rtc::AsyncPacketSocket::State MultiplexedUdpSocket::GetState() const {
+        return shared ? STATE_BOUND : STATE_CLOSED;
+    }
+
+    int MultiplexedUdpSocket::GetOption(const rtc::Socket::Option opt, int* value) {
+        return shared ? shared->packetSocket()->GetOption(opt, value) : -1;
+    }
+
+    int MultiplexedUdpSocket::SetOption(const rtc::Socket::Option opt, const int value) {
+        return shared ? shared->packetSocket()->SetOption(opt, value) : -1;
+    }
+
+    int MultiplexedUdpSocket::GetError() const {
+        return error;
+    }
+
+    void MultiplexedUdpSocket::SetError(const int newError) {
+        error = newError;
+    }
+} // wrtc
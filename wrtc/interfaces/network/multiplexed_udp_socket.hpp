@@ -0,0 +1,45 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#pragma once
+
+#include <string>
+#include <rtc_base/async_packet_socket.h>
+
+namespace wrtc {
+    class SharedUdpSocket;
+
+    class MultiplexedUdpSocket final : public rtc::AsyncPacketSocket {
+        SharedUdpSocket* shared;
+        int error = 0;
+
+    public:
+        MultiplexedUdpSocket(SharedUdpSocket* shared, const std::string& ufrag);
+
+        ~MultiplexedUdpSocket() override;
+
+        void deliver(const rtc::ReceivedPacket& packet);
+
+        rtc::SocketAddress GetLocalAddress() const override;
+
+        rtc::SocketAddress GetRemoteAddress() const override;
+
+        int Send(const void* data, size_t size, const rtc::PacketOptions& options) override;
+
+        int SendTo(const void* data, size_t size, const rtc::SocketAddress& address, const rtc::PacketOptions& options) override;
+
+        int Close() override;
+
+        State GetState() const override;
+
+        int GetOption(rtc::Socket::Option opt, int* value) override;
+
+        int SetOption(rtc::Socket::Option opt, int value) override;
+
+        int GetError() const override;
+
+        void SetError(int error) override;
+    };
+
+} // wrtc
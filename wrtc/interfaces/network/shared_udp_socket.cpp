@@ -0,0 +1,153 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#include "shared_udp_socket.hpp"
+
+#include <optional>
+#include <string_view>
+#include <rtc_base/byte_order.h>
+#include <rtc_base/logging.h>
+
+#include "multiplexed_udp_socket.hpp"
+
+namespace wrtc {
+    namespace {
+        constexpr uint32_t StunMagicCookie = 0x2112A442;
+        constexpr size_t StunHeaderSize = 20;
+        constexpr uint16_t StunClassMask = 0x0110;
+        constexpr uint16_t StunResponseBit = 0x0100;
+        constexpr uint16_t StunUsername = 0x0006;
+
+        bool isStun(const uint8_t* data, const size_t size) {
+            return size >= StunHeaderSize &&
+                (data[0] & 0xC0) == 0 &&
+                rtc::GetBE32(data + 4) == StunMagicCookie &&
+                StunHeaderSize + rtc::GetBE16(data + 2) <= size;
+        }
+
+        bool isStunRequest(const uint8_t* data) {
+            return (rtc::GetBE16(data) & StunClassMask) == 0;
+        }
+
+        bool isStunResponse(const uint8_t* data) {
+            return (rtc::GetBE16(data) & StunResponseBit) != 0;
+        }
+
+        std::string transactionId(const uint8_t* data) {
+            return {reinterpret_cast<const char*>(data + 8), 12};
+        }
+
+        std::optional<std::string_view> stunUsername(const uint8_t* data, const size_t size) {
+            const size_t end = StunHeaderSize + rtc::GetBE16(data + 2);
+            for (size_t offset = StunHeaderSize; offset + 4 <= end && end <= size;) {
+                const uint16_t type = rtc::GetBE16(data + offset);
+                const uint16_t length = rtc::GetBE16(data + offset + 2);
+                if (offset + 4 + length > end) {
+                    break;
+                }
+                if (type == StunUsername) {
+                    return std::string_view(reinterpret_cast<const char*>(data + offset + 4), length);
+                }
+                offset += 4 + ((length + 3) & ~3);
+            }
+            return std::nullopt;
+        }
+    }
+
+    SharedUdpSocket::SharedUdpSocket(std::unique_ptr<rtc::AsyncPacketSocket> socket, std::function<void()> onIdle): socket(std::move(socket)), onIdle(std::move(onIdle)) {
+        this->socket->RegisterReceivedPacketCallback([this](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket& packet) {
+            if (auto* owner = route(packet)) {
+                owner->deliver(packet);
+            }
+        });
+        this->socket->SignalReadyToSend.connect(this, &SharedUdpSocket::onReadyToSend);
+    }
+
+    SharedUdpSocket::~SharedUdpSocket() {
+        socket->DeregisterReceivedPacketCallback();
+        socket->SignalReadyToSend.disconnect(this);
+    }
+
+    rtc::AsyncPacketSocket* SharedUdpSocket::packetSocket() const {
+        return socket.get();
+    }
+
+    bool SharedUdpSocket::idle() const {
+        return owners.empty();
+    }
+
+    void SharedUdpSocket::attach(MultiplexedUdpSocket* owner, const std::string& ufrag) {
+        owners.insert(owner);
+        ufrags[ufrag] = owner;
+    }
+
+    void SharedUdpSocket::detach(MultiplexedUdpSocket* owner) {
+        owners.erase(owner);
+        std::erase_if(ufrags, [owner](const auto& entry) {
+            return entry.second == owner;
+        });
+        std::erase_if(remotes, [owner](const auto& entry) {
+            return entry.second == owner;
+        });
+        std::erase_if(transactions, [owner](const auto& entry) {
+            return entry.second == owner;
+        });
+        if (owners.empty() && onIdle) {
+            onIdle();
+        }
+    }
+
+    int SharedUdpSocket::sendTo(MultiplexedUdpSocket* owner, const void* data, const size_t size, const rtc::SocketAddress& address, const rtc::PacketOptions& options) {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        if (isStun(bytes, size) && isStunRequest(bytes)) {
+            if (transactions.insert_or_assign(transactionId(bytes), owner).second) {
+                transactionOrder.push_back(transactionId(bytes));
+                if (transactionOrder.size() > MaxTransactions) {
+                    transactions.erase(transactionOrder.front());
+                    transactionOrder.pop_front();
+                }
+            }
+        }
+        if (const auto it = remotes.find(address); it == remotes.end()) {
+            remotes.emplace(address, owner);
+        } else if (it->second != owner) {
+            RTC_LOG(LS_VERBOSE) << "Shared socket remote " << address.ToSensitiveString() << " moved to another connection";
+            it->second = owner;
+        }
+        return socket->SendTo(data, size, address, options);
+    }
+
+    MultiplexedUdpSocket* SharedUdpSocket::route(const rtc::ReceivedPacket& packet) {
+        const auto* data = packet.payload().data();
+        const auto size = packet.payload().size();
+        if (isStun(data, size)) {
+            if (isStunRequest(data)) {
+                if (const auto username = stunUsername(data, size)) {
+                    const auto localUfrag = username->substr(0, username->find(':'));
+                    if (const auto it = ufrags.find(std::string(localUfrag)); it != ufrags.end()) {
+                        remotes.insert_or_assign(packet.source_address(), it->second);
+                        return it->second;
+                    }
+                }
+            } else if (isStunResponse(data)) {
+                if (const auto it = transactions.find(transactionId(data)); it != transactions.end()) {
+                    return it->second;
+                }
+            }
+        }
+        if (const auto it = remotes.find(packet.source_address()); it != remotes.end()) {
+            return it->second;
+        }
+        return nullptr;
+    }
+
+    void SharedUdpSocket::onReadyToSend(rtc::AsyncPacketSocket*) {
+        const auto snapshot = owners;
+        for (auto* owner : snapshot) {
+            if (owners.contains(owner)) {
+                owner->SignalReadyToSend(owner);
+            }
+        }
+    }
+} // wrtc
@@ -0,0 +1,54 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <rtc_base/async_packet_socket.h>
+#include <rtc_base/third_party/sigslot/sigslot.h>
+
+namespace wrtc {
+    class MultiplexedUdpSocket;
+
+    // One UDP socket bound per local interface and shared by the ICE ports of
+    // every connection on a shard. Incoming STUN requests are routed by the
+    // local ufrag of their USERNAME, STUN responses by transaction id and
+    // everything else by the remote address the owner last talked to.
+    class SharedUdpSocket final : public sigslot::has_slots<> {
+        static constexpr size_t MaxTransactions = 4096;
+
+        std::unique_ptr<rtc::AsyncPacketSocket> socket;
+        std::function<void()> onIdle;
+        std::set<MultiplexedUdpSocket*> owners;
+        std::unordered_map<std::string, MultiplexedUdpSocket*> ufrags;
+        std::map<rtc::SocketAddress, MultiplexedUdpSocket*> remotes;
+        std::unordered_map<std::string, MultiplexedUdpSocket*> transactions;
+        std::deque<std::string> transactionOrder;
+
+        MultiplexedUdpSocket* route(const rtc::ReceivedPacket& packet);
+
+        void onReadyToSend(rtc::AsyncPacketSocket* socket);
+
+    public:
+        SharedUdpSocket(std::unique_ptr<rtc::AsyncPacketSocket> socket, std::function<void()> onIdle);
+
+        ~SharedUdpSocket() override;
+
+        rtc::AsyncPacketSocket* packetSocket() const;
+
+        bool idle() const;
+
+        void attach(MultiplexedUdpSocket* owner, const std::string& ufrag);
+
+        void detach(MultiplexedUdpSocket* owner);
+
+        int sendTo(MultiplexedUdpSocket* owner, const void* data, size_t size, const rtc::SocketAddress& address, const rtc::PacketOptions& options);
+    };
+
+} // wrtc
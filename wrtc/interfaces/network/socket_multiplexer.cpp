@@ -0,0 +1,43 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#include "socket_multiplexer.hpp"
+
+#include <rtc_base/thread.h>
+
+#include "multiplexed_udp_socket.hpp"
+
+namespace wrtc {
+    SocketMultiplexer::SocketMultiplexer(rtc::PacketSocketFactory* socketFactory): socketFactory(socketFactory) {}
+
+    rtc::AsyncPacketSocket* SocketMultiplexer::createUdpSocket(const rtc::SocketAddress& address, const uint16_t minPort, const uint16_t maxPort, const std::string& ufrag) {
+        if (address.port() != 0) {
+            return socketFactory->CreateUdpSocket(address, minPort, maxPort);
+        }
+        auto it = sockets.find(address.ipaddr());
+        if (it == sockets.end()) {
+            auto* socket = socketFactory->CreateUdpSocket(address, minPort, maxPort);
+            if (!socket) {
+                return nullptr;
+            }
+            it = sockets.emplace(address.ipaddr(), std::make_unique<SharedUdpSocket>(
+                std::unique_ptr<rtc::AsyncPacketSocket>(socket),
+                [this, ip = address.ipaddr()] {
+                    release(ip);
+                }
+            )).first;
+        }
+        return new MultiplexedUdpSocket(it->second.get(), ufrag);
+    }
+
+    void SocketMultiplexer::release(const rtc::IPAddress& address) {
+        // The last owner may detach from inside one of the shared socket's own
+        // callbacks, so the socket is closed on a later turn of the network thread
+        rtc::Thread::Current()->PostTask(webrtc::SafeTask(safety.flag(), [this, address] {
+            if (const auto it = sockets.find(address); it != sockets.end() && it->second->idle()) {
+                sockets.erase(it);
+            }
+        }));
+    }
+} // wrtc
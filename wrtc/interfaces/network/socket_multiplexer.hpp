@@ -0,0 +1,29 @@
+//
+// Created by Laky64 on 19/09/2024.
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <api/packet_socket_factory.h>
+#include <api/task_queue/pending_task_safety_flag.h>
+
+#include "shared_udp_socket.hpp"
+
+namespace wrtc {
+
+    class SocketMultiplexer {
+        rtc::PacketSocketFactory* socketFactory;
+        std::map<rtc::IPAddress, std::unique_ptr<SharedUdpSocket>> sockets;
+        webrtc::ScopedTaskSafety safety;
+
+        void release(const rtc::IPAddress& address);
+
+    public:
+        explicit SocketMultiplexer(rtc::PacketSocketFactory* socketFactory);
+
+        rtc::AsyncPacketSocket* createUdpSocket(const rtc::SocketAddress& address, uint16_t minPort, uint16_t maxPort, const std::string& ufrag);
+    };
+
+} // wrtc
@@ -33,6 +33,10 @@ namespace wrtc {
         return factory->workerThread();
     }
 
+    rtc::scoped_refptr<PeerConnectionFactory> NetworkInterface::getFactory() const {
+        return factory;
+    }
+
     const webrtc::Environment& NetworkInterface::environment() const {
         return factory->environment();
     }
@@ -49,9 +53,21 @@ namespace wrtc {
         connectionChangeCallback = callback;
     }
 
+    void NetworkInterface::onSetupMilestone(const std::function<void(SetupMilestone milestone)>& callback) {
+        setupMilestoneCallback = callback;
+    }
+
+    void NetworkInterface::notifySetupMilestone(const SetupMilestone milestone) {
+        const auto bit = static_cast<uint8_t>(milestone);
+        if (reachedMilestones.fetch_or(bit) & bit) {
+            return;
+        }
+        (void) setupMilestoneCallback(milestone);
+    }
+
     void NetworkInterface::close() {
         if (factory) {
-            PeerConnectionFactory::UnRef();
+            PeerConnectionFactory::UnRef(factory);
             factory = nullptr;
         }
     }
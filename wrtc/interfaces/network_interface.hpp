@@ -6,6 +6,10 @@
 #include "media/tracks/media_track_interface.hpp"
 #include "peer_connection/peer_connection_factory.hpp"
 #include "wrtc/enums.hpp"
+#include "wrtc/models/bandwidth_stats.hpp"
+#include "wrtc/models/call_stats.hpp"
+#include "wrtc/models/encoder_stats.hpp"
+#include "wrtc/models/encoding_profile.hpp"
 #include "wrtc/models/ice_candidate.hpp"
 #include "wrtc/utils/binary.hpp"
 #include "wrtc/utils/syncronized_callback.hpp"
@@ -13,15 +17,20 @@
 namespace wrtc {
 
     class NetworkInterface {
+        std::atomic_uint8_t reachedMilestones = 0;
+
     protected:
         rtc::scoped_refptr<PeerConnectionFactory> factory;
         synchronized_callback<void> dataChannelOpenedCallback;
         synchronized_callback<IceCandidate> iceCandidateCallback;
         synchronized_callback<ConnectionState> connectionChangeCallback;
+        synchronized_callback<SetupMilestone> setupMilestoneCallback;
         bool dataChannelOpen = false;
 
         static webrtc::IceCandidateInterface* parseIceCandidate(const IceCandidate& rawCandidate);
 
+        void notifySetupMilestone(SetupMilestone milestone);
+
     public:
         NetworkInterface();
 
@@ -33,6 +42,8 @@ namespace wrtc {
 
         [[nodiscard]] rtc::Thread *workerThread() const;
 
+        [[nodiscard]] rtc::scoped_refptr<PeerConnectionFactory> getFactory() const;
+
         const webrtc::Environment& environment() const;
 
         void onDataChannelOpened(const std::function<void()> &callback);
@@ -41,6 +52,8 @@ namespace wrtc {
 
         void onConnectionChange(const std::function<void(ConnectionState state)> &callback);
 
+        void onSetupMilestone(const std::function<void(SetupMilestone milestone)> &callback);
+
         virtual void close();
 
         virtual void sendDataChannelMessage(const bytes::binary &data) const = 0;
@@ -49,6 +62,16 @@ namespace wrtc {
 
         virtual std::unique_ptr<MediaTrackInterface> addTrack(const rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>& track) = 0;
 
+        virtual void setAudioEncoding(const AudioEncodingProfile& profile) = 0;
+
+        virtual void setVideoEncoding(const VideoEncodingProfile& profile) = 0;
+
+        virtual void encoderStats(const std::function<void(const EncoderStats&)>& callback) const = 0;
+
+        virtual CallStats stats() const = 0;
+
+        virtual void bandwidthStats(const std::function<void(const BandwidthStats&)>& callback) const = 0;
+
         bool isDataChannelOpen() const;
     };
 
@@ -5,8 +5,15 @@
 #include "peer_connection.hpp"
 
 #include <future>
+#include <absl/strings/match.h>
+#include <api/stats/rtcstats_objects.h>
+#include <media/base/media_constants.h>
+#include <pc/peer_connection.h>
+#include <pc/peer_connection_proxy.h>
+#include <rtc_base/logging.h>
 
 #include "peer_connection/set_session_description_observer.hpp"
+#include "peer_connection/stats_collector_callback.hpp"
 
 namespace wrtc {
 
@@ -132,6 +139,185 @@ namespace wrtc {
         });
     }
 
+    void PeerConnection::prepareTransceivers() const {
+        if (!peerConnection) {
+            throw RTCException("Cannot add transceivers; PeerConnection is closed");
+        }
+        // addTrack takes over an unused transceiver of the same kind instead of creating one
+        webrtc::RtpTransceiverInit init;
+        init.direction = webrtc::RtpTransceiverDirection::kRecvOnly;
+        for (const auto mediaType : {cricket::MEDIA_TYPE_AUDIO, cricket::MEDIA_TYPE_VIDEO}) {
+            if (const auto result = peerConnection->AddTransceiver(mediaType, init); !result.ok()) {
+                throw wrapRTCError(result.error());
+            }
+        }
+    }
+
+    void PeerConnection::setAudioEncoding(const AudioEncodingProfile& profile) {
+        RTC_LOG(LS_VERBOSE) << "Only the bitrate of the audio encoding profile can be changed without renegotiation";
+        updateSenders(cricket::MEDIA_TYPE_AUDIO, [&](webrtc::RtpParameters& parameters, webrtc::MediaStreamTrackInterface*) {
+            for (auto& encoding : parameters.encodings) {
+                encoding.max_bitrate_bps = profile.bitrate;
+            }
+        });
+    }
+
+    void PeerConnection::setVideoEncoding(const VideoEncodingProfile& profile) {
+        updateSenders(cricket::MEDIA_TYPE_VIDEO, [&](webrtc::RtpParameters& parameters, webrtc::MediaStreamTrackInterface* track) {
+            // The negotiated codecs stay the same, only the one used by the encoder changes
+            absl::optional<webrtc::RtpCodec> sendCodec;
+            if (profile.lightweightCodec && !parameters.codecs.empty() && absl::EqualsIgnoreCase(parameters.codecs.front().name, cricket::kAv1CodecName)) {
+                for (const auto& codec : parameters.codecs) {
+                    if (absl::EqualsIgnoreCase(codec.name, cricket::kVp8CodecName)) {
+                        sendCodec = codec;
+                        break;
+                    }
+                }
+            }
+            for (auto& encoding : parameters.encodings) {
+                encoding.codec = sendCodec;
+                encoding.min_bitrate_bps = profile.minBitrate;
+                encoding.max_bitrate_bps = profile.maxBitrate;
+                encoding.max_framerate = profile.maxFramerate;
+                encoding.scale_resolution_down_by = profile.scaleResolutionDownBy;
+            }
+            if (const auto videoTrack = dynamic_cast<webrtc::VideoTrackInterface*>(track)) {
+                videoTrack->set_content_hint(profile.screencast ? webrtc::VideoTrackInterface::ContentHint::kText : webrtc::VideoTrackInterface::ContentHint::kNone);
+            }
+        });
+    }
+
+    void PeerConnection::encoderStats(const std::function<void(const EncoderStats&)>& callback) const {
+        if (!peerConnection) {
+            callback({});
+            return;
+        }
+        peerConnection->GetStats(rtc::make_ref_counted<StatsCollectorCallback>([callback](const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) {
+            EncoderStats stats;
+            for (const auto outbound : report->GetStatsOfType<webrtc::RTCOutboundRtpStreamStats>()) {
+                if (outbound->kind.value_or("") != "video") {
+                    continue;
+                }
+                stats.framesEncoded += outbound->frames_encoded.value_or(0);
+                stats.totalEncodeTimeMs += outbound->total_encode_time.value_or(0) * 1000;
+            }
+            callback(stats);
+        }).get());
+    }
+
+    CallStats PeerConnection::stats() const {
+        if (!peerConnection) {
+            return {};
+        }
+        std::promise<CallStats> promise;
+        peerConnection->GetStats(rtc::make_ref_counted<StatsCollectorCallback>([&promise](const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) {
+            CallStats stats;
+            for (const auto transport : report->GetStatsOfType<webrtc::RTCTransportStats>()) {
+                stats.bytesSent += transport->bytes_sent.value_or(0);
+                stats.bytesReceived += transport->bytes_received.value_or(0);
+                stats.packetsSent += transport->packets_sent.value_or(0);
+                stats.packetsReceived += transport->packets_received.value_or(0);
+                if (!transport->selected_candidate_pair_id) {
+                    continue;
+                }
+                const auto pair = report->GetAs<webrtc::RTCIceCandidatePairStats>(*transport->selected_candidate_pair_id);
+                if (!pair) {
+                    continue;
+                }
+                stats.rttMs = pair->current_round_trip_time.value_or(0) * 1000;
+                stats.sendBandwidth = static_cast<int64_t>(pair->available_outgoing_bitrate.value_or(0));
+                stats.recvBandwidth = static_cast<int64_t>(pair->available_incoming_bitrate.value_or(0));
+                const auto local = report->GetAs<webrtc::RTCLocalIceCandidateStats>(pair->local_candidate_id.value_or(""));
+                const auto remote = report->GetAs<webrtc::RTCRemoteIceCandidateStats>(pair->remote_candidate_id.value_or(""));
+                if (local && remote) {
+                    stats.candidatePair = CandidatePairStats{
+                        local->address.value_or("") + ":" + std::to_string(local->port.value_or(0)),
+                        local->candidate_type.value_or(""),
+                        remote->address.value_or("") + ":" + std::to_string(remote->port.value_or(0)),
+                        remote->candidate_type.value_or(""),
+                        local->protocol.value_or(""),
+                    };
+                }
+            }
+            for (const auto inbound : report->GetStatsOfType<webrtc::RTCInboundRtpStreamStats>()) {
+                stats.packetsLost += inbound->packets_lost.value_or(0);
+                stats.jitterMs = std::max(stats.jitterMs, inbound->jitter.value_or(0) * 1000);
+                stats.framesDropped += inbound->frames_dropped.value_or(0);
+            }
+            for (const auto remoteInbound : report->GetStatsOfType<webrtc::RTCRemoteInboundRtpStreamStats>()) {
+                stats.fractionLost = std::max(stats.fractionLost, remoteInbound->fraction_lost.value_or(0));
+            }
+            for (const auto outbound : report->GetStatsOfType<webrtc::RTCOutboundRtpStreamStats>()) {
+                if (outbound->kind.value_or("") != "video") {
+                    continue;
+                }
+                stats.framesEncoded += outbound->frames_encoded.value_or(0);
+                stats.totalEncodeTimeMs += outbound->total_encode_time.value_or(0) * 1000;
+            }
+            promise.set_value(stats);
+        }).get());
+        return promise.get_future().get();
+    }
+
+    void PeerConnection::bandwidthStats(const std::function<void(const BandwidthStats&)>& callback) const {
+        if (!peerConnection) {
+            callback({});
+            return;
+        }
+        // The estimate comes straight from the Call and the send channels, the
+        // same sources the RTCStatsReport is built from, without building one
+        signalingThread()->PostTask([connection = peerConnection, workerThread = workerThread(), callback] {
+            auto* internal = static_cast<webrtc::PeerConnection*>(static_cast<webrtc::PeerConnectionProxy*>(connection.get())->internal());
+            std::vector<cricket::ChannelInterface*> channels;
+            for (const auto& transceiver : internal->GetTransceiversInternal()) {
+                if (const auto channel = transceiver->internal()->channel()) {
+                    channels.push_back(channel);
+                }
+            }
+            const auto stats = workerThread->BlockingCall([&] {
+                BandwidthStats result;
+                const auto callStats = internal->GetCallStats();
+                result.sendBandwidth = callStats.send_bandwidth_bps;
+                result.rttMs = static_cast<double>(std::max<int64_t>(callStats.rtt_ms, 0));
+                for (const auto channel : channels) {
+                    if (channel->media_type() == cricket::MEDIA_TYPE_AUDIO) {
+                        cricket::VoiceMediaSendInfo info;
+                        if (channel->voice_media_send_channel()->GetStats(&info)) {
+                            for (const auto& sender : info.senders) {
+                                result.fractionLost = std::max(result.fractionLost, static_cast<double>(sender.fraction_lost));
+                            }
+                        }
+                    } else if (channel->media_type() == cricket::MEDIA_TYPE_VIDEO) {
+                        cricket::VideoMediaSendInfo info;
+                        if (channel->video_media_send_channel()->GetStats(&info)) {
+                            for (const auto& sender : info.senders) {
+                                result.fractionLost = std::max(result.fractionLost, static_cast<double>(sender.fraction_lost));
+                            }
+                        }
+                    }
+                }
+                return result;
+            });
+            callback(stats);
+        });
+    }
+
+    void PeerConnection::updateSenders(const cricket::MediaType mediaType, const std::function<void(webrtc::RtpParameters&, webrtc::MediaStreamTrackInterface*)>& update) const {
+        if (!peerConnection) {
+            return;
+        }
+        for (const auto& sender : peerConnection->GetSenders()) {
+            if (sender->media_type() != mediaType) {
+                continue;
+            }
+            auto parameters = sender->GetParameters();
+            update(parameters, sender->track().get());
+            if (const auto result = sender->SetParameters(parameters); !result.ok()) {
+                RTC_LOG(LS_WARNING) << "Failed to update sender parameters: " << result.message();
+            }
+        }
+    }
+
     void PeerConnection::restartIce() const {
         if (peerConnection) {
             peerConnection->RestartIce();
@@ -268,9 +454,11 @@ namespace wrtc {
                 break;
             case webrtc::PeerConnectionInterface::kIceConnectionConnected:
                 newValue = IceState::Connected;
+                notifySetupMilestone(SetupMilestone::IceConnected);
                 break;
             case webrtc::PeerConnectionInterface::kIceConnectionCompleted:
                 newValue = IceState::Completed;
+                notifySetupMilestone(SetupMilestone::IceConnected);
                 break;
             case webrtc::PeerConnectionInterface::kIceConnectionFailed:
             case webrtc::PeerConnectionInterface::kIceConnectionMax:
@@ -297,12 +485,14 @@ namespace wrtc {
                 break;
             case webrtc::PeerConnectionInterface::kIceGatheringComplete:
                 newValue = GatheringState::Complete;
+                notifySetupMilestone(SetupMilestone::GatheringComplete);
                 break;
         }
         (void) gatheringStateChangeCallback(newValue);
     }
 
     void PeerConnection::OnIceCandidate(const webrtc::IceCandidateInterface *candidate) {
+        notifySetupMilestone(SetupMilestone::FirstCandidate);
         iceCandidateCallback(IceCandidate(candidate));
     }
 
@@ -344,6 +534,7 @@ namespace wrtc {
                 break;
             case webrtc::PeerConnectionInterface::PeerConnectionState::kConnected:
                 newValue = ConnectionState::Connected;
+                notifySetupMilestone(SetupMilestone::DtlsConnected);
                 break;
             case webrtc::PeerConnectionInterface::PeerConnectionState::kDisconnected:
                 newValue = ConnectionState::Disconnected;
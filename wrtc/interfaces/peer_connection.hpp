@@ -36,6 +36,18 @@ namespace wrtc {
 
         std::unique_ptr<MediaTrackInterface> addTrack(const rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>& track) override;
 
+        void prepareTransceivers() const;
+
+        void setAudioEncoding(const AudioEncodingProfile& profile) override;
+
+        void setVideoEncoding(const VideoEncodingProfile& profile) override;
+
+        void encoderStats(const std::function<void(const EncoderStats&)>& callback) const override;
+
+        CallStats stats() const override;
+
+        void bandwidthStats(const std::function<void(const BandwidthStats&)>& callback) const override;
+
         void addIceCandidate(const IceCandidate& rawCandidate) const override;
 
         void restartIce() const;
@@ -99,6 +111,8 @@ namespace wrtc {
         void onDataChannelStateUpdated();
 
         void attachDataChannel(const rtc::scoped_refptr<webrtc::DataChannelInterface>& dataChannel);
+
+        void updateSenders(cricket::MediaType mediaType, const std::function<void(webrtc::RtpParameters&, webrtc::MediaStreamTrackInterface*)>& update) const;
     };
 
 } // wrtc
@@ -3,22 +3,30 @@
 //
 
 #include "peer_connection_factory.hpp"
+#include <algorithm>
 #include <api/enable_media.h>
 #include <rtc_base/ssl_adapter.h>
 #include <api/create_peerconnection_factory.h>
 #include <api/rtc_event_log/rtc_event_log_factory.h>
 #include <api/task_queue/default_task_queue_factory.h>
-#include <api/audio_codecs/builtin_audio_encoder_factory.h>
 #include <api/audio_codecs/builtin_audio_decoder_factory.h>
 #include <pc/media_factory.h>
 #include <system_wrappers/include/field_trial.h>
+#include <rtc_base/logging.h>
 
+#include "wrtc/audio_factory/audio_encoder_factory.hpp"
 #include "wrtc/video_factory/video_factory_config.hpp"
+#ifdef IS_LINUX
+#include "wrtc/interfaces/network/batched_packet_socket_factory.hpp"
+#endif
 
 namespace wrtc {
     std::mutex PeerConnectionFactory::_mutex{};
     int PeerConnectionFactory::_references = 0;
-    rtc::scoped_refptr<PeerConnectionFactory> PeerConnectionFactory::_default = nullptr;
+    size_t PeerConnectionFactory::_shardCount = 1;
+    std::atomic_bool PeerConnectionFactory::_socketSharing = false;
+    std::atomic_bool PeerConnectionFactory::_batchedSend = false;
+    std::vector<rtc::scoped_refptr<PeerConnectionFactory>> PeerConnectionFactory::_shards{};
 
     PeerConnectionFactory::PeerConnectionFactory() {
         webrtc::field_trial::InitFieldTrialsFromString(
@@ -27,14 +35,15 @@ namespace wrtc {
             "WebRTC-Audio-iOS-Holding/Enabled/"
             "WebRTC-IceFieldTrials/skip_relay_to_non_relay_connections:true/"
         );
+        const auto suffix = _shards.empty() ? "" : "-" + std::to_string(_shards.size());
         network_thread_ = rtc::Thread::CreateWithSocketServer();
-        network_thread_->SetName("ntg-net", nullptr);
+        network_thread_->SetName("ntg-net" + suffix, nullptr);
         network_thread_->Start();
         worker_thread_ = rtc::Thread::Create();
-        worker_thread_->SetName("ntg-work", nullptr);
+        worker_thread_->SetName("ntg-work" + suffix, nullptr);
         worker_thread_->Start();
         signaling_thread_ = rtc::Thread::Create();
-        signaling_thread_->SetName("ntg-media", nullptr);
+        signaling_thread_->SetName("ntg-media" + suffix, nullptr);
         signaling_thread_->Start();
 
         signaling_thread_->AllowInvokesToThread(worker_thread_.get());
@@ -47,13 +56,21 @@ namespace wrtc {
         dependencies.signaling_thread = signaling_thread_.get();
         dependencies.task_queue_factory = webrtc::CreateDefaultTaskQueueFactory();
         dependencies.event_log_factory = std::make_unique<webrtc::RtcEventLogFactory>();
+#ifdef IS_LINUX
+        batchedDefault = _batchedSend;
+        if (batchedDefault) {
+            dependencies.packet_socket_factory = std::make_unique<BatchedPacketSocketFactory>(
+                static_cast<rtc::PhysicalSocketServer*>(network_thread_->socketserver())
+            );
+        }
+#endif
         dependencies.adm = worker_thread_->BlockingCall([&] {
             if (!_audioDeviceModule)
                 _audioDeviceModule = webrtc::AudioDeviceModule::Create(webrtc::AudioDeviceModule::kDummyAudio, dependencies.task_queue_factory.get());
             return _audioDeviceModule;
         });
         auto config = VideoFactoryConfig();
-        dependencies.audio_encoder_factory = webrtc::CreateBuiltinAudioEncoderFactory();
+        dependencies.audio_encoder_factory = CreateAudioEncoderFactory();
         dependencies.audio_decoder_factory = webrtc::CreateBuiltinAudioDecoderFactory();
         dependencies.video_encoder_factory = config.CreateVideoEncoderFactory();
         dependencies.video_decoder_factory = config.CreateVideoDecoderFactory();
@@ -78,6 +95,12 @@ namespace wrtc {
                     _audioDeviceModule = nullptr;
             });
         }
+        if (socket_multiplexer_ || batched_socket_factory_) {
+            network_thread_->BlockingCall([this] {
+                socket_multiplexer_ = nullptr;
+                batched_socket_factory_ = nullptr;
+            });
+        }
         factory_ = nullptr;
         worker_thread_->Stop();
         signaling_thread_->Stop();
@@ -108,6 +131,34 @@ namespace wrtc {
         return connection_context_->default_socket_factory();
     }
 
+    SocketMultiplexer* PeerConnectionFactory::socketMultiplexer() {
+        RTC_DCHECK_RUN_ON(network_thread_.get());
+        if (!_socketSharing) {
+            return nullptr;
+        }
+        if (!socket_multiplexer_) {
+            socket_multiplexer_ = std::make_unique<SocketMultiplexer>(socketFactory());
+        }
+        return socket_multiplexer_.get();
+    }
+
+    rtc::PacketSocketFactory* PeerConnectionFactory::batchedSocketFactory() {
+        RTC_DCHECK_RUN_ON(network_thread_.get());
+#ifdef IS_LINUX
+        if (batchedDefault) {
+            return socketFactory();
+        }
+        if (!batched_socket_factory_) {
+            batched_socket_factory_ = std::make_unique<BatchedPacketSocketFactory>(
+                static_cast<rtc::PhysicalSocketServer*>(network_thread_->socketserver())
+            );
+        }
+        return batched_socket_factory_.get();
+#else
+        return socketFactory();
+#endif
+    }
+
     rtc::UniqueRandomIdGenerator* PeerConnectionFactory::ssrcGenerator() const {
         return connection_context_->ssrc_generator();
     }
@@ -133,17 +184,49 @@ namespace wrtc {
         _references++;
         if (_references == 1) {
             rtc::InitializeSSL();
-            _default = rtc::scoped_refptr<PeerConnectionFactory>(new rtc::RefCountedObject<PeerConnectionFactory>());
         }
-        return _default;
+        rtc::scoped_refptr<PeerConnectionFactory> shard;
+        for (const auto& candidate : _shards) {
+            if (!shard || candidate->load < shard->load) {
+                shard = candidate;
+            }
+        }
+        if (!shard || shard->load > 0 && _shards.size() < _shardCount) {
+            shard = rtc::scoped_refptr<PeerConnectionFactory>(new rtc::RefCountedObject<PeerConnectionFactory>());
+            _shards.push_back(shard);
+            RTC_LOG(LS_INFO) << "PeerConnectionFactory shard " << _shards.size() << "/" << _shardCount << " created";
+        }
+        shard->load++;
+        return shard;
     }
 
-    void PeerConnectionFactory::UnRef() {
+    void PeerConnectionFactory::UnRef(const rtc::scoped_refptr<PeerConnectionFactory>& shard) {
         std::lock_guard lock(_mutex);
+        if (shard) {
+            shard->load--;
+        }
         _references--;
         if (!_references) {
-            _default = nullptr;
+            _shards.clear();
             rtc::CleanupSSL();
         }
     }
+
+    void PeerConnectionFactory::SetShardCount(const size_t count) {
+        std::lock_guard lock(_mutex);
+        _shardCount = std::max<size_t>(count, 1);
+    }
+
+    size_t PeerConnectionFactory::ShardCount() {
+        std::lock_guard lock(_mutex);
+        return _shardCount;
+    }
+
+    void PeerConnectionFactory::SetSocketSharing(const bool enabled) {
+        _socketSharing = enabled;
+    }
+
+    void PeerConnectionFactory::SetBatchedSend(const bool enabled) {
+        _batchedSend = enabled;
+    }
 } // wrtc
\ No newline at end of file
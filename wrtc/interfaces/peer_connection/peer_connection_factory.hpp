@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <vector>
 #include <api/peer_connection_interface.h>
 
 #include "peer_connection_factory_with_context.hpp"
+#include "wrtc/interfaces/network/socket_multiplexer.hpp"
 
 namespace wrtc {
 
@@ -19,7 +22,15 @@ namespace wrtc {
 
         static rtc::scoped_refptr<PeerConnectionFactory> GetOrCreateDefault();
 
-        static void UnRef();
+        static void UnRef(const rtc::scoped_refptr<PeerConnectionFactory>& shard);
+
+        static void SetShardCount(size_t count);
+
+        static size_t ShardCount();
+
+        static void SetSocketSharing(bool enabled);
+
+        static void SetBatchedSend(bool enabled);
 
         rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> factory();
 
@@ -33,6 +44,10 @@ namespace wrtc {
 
         [[nodiscard]] rtc::PacketSocketFactory* socketFactory() const;
 
+        [[nodiscard]] SocketMultiplexer* socketMultiplexer();
+
+        [[nodiscard]] rtc::PacketSocketFactory* batchedSocketFactory();
+
         [[nodiscard]] rtc::UniqueRandomIdGenerator* ssrcGenerator() const;
 
         [[nodiscard]] cricket::MediaEngineInterface* mediaEngine() const;
@@ -45,12 +60,20 @@ namespace wrtc {
     private:
         static std::mutex _mutex;
         static int _references;
-        static rtc::scoped_refptr<PeerConnectionFactory> _default;
+        static size_t _shardCount;
+        static std::atomic_bool _socketSharing;
+        static std::atomic_bool _batchedSend;
+        static std::vector<rtc::scoped_refptr<PeerConnectionFactory>> _shards;
+
+        int load = 0;
+        bool batchedDefault = false;
 
         std::unique_ptr<rtc::Thread> network_thread_;
         std::unique_ptr<rtc::Thread> worker_thread_;
         std::unique_ptr<rtc::Thread> signaling_thread_;
         rtc::scoped_refptr<webrtc::ConnectionContext> connection_context_;
+        std::unique_ptr<SocketMultiplexer> socket_multiplexer_;
+        std::unique_ptr<rtc::PacketSocketFactory> batched_socket_factory_;
 
         rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> factory_;
         rtc::scoped_refptr<webrtc::AudioDeviceModule> _audioDeviceModule;
@@ -0,0 +1,13 @@
+//
+// Created by Laky64 on 15/09/2024.
+//
+
+#include "stats_collector_callback.hpp"
+
+namespace wrtc {
+    void StatsCollectorCallback::OnStatsDelivered(const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) {
+        if (onStats) {
+            onStats(report);
+        }
+    }
+} // wrtc
@@ -0,0 +1,21 @@
+//
+// Created by Laky64 on 15/09/2024.
+//
+
+#pragma once
+
+#include <functional>
+#include <api/stats/rtc_stats_collector_callback.h>
+
+namespace wrtc {
+
+    class StatsCollectorCallback final : public webrtc::RTCStatsCollectorCallback {
+        std::function<void(const rtc::scoped_refptr<const webrtc::RTCStatsReport>&)> onStats;
+
+    public:
+        explicit StatsCollectorCallback(const std::function<void(const rtc::scoped_refptr<const webrtc::RTCStatsReport>&)>& onStats): onStats(onStats) {}
+
+        void OnStatsDelivered(const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) override;
+    };
+
+} // wrtc
@@ -4,11 +4,11 @@
 
 #include "reflector_port.hpp"
 
+#include <charconv>
 #include <functional>
 #include <memory>
 #include <utility>
 #include <random>
-#include <sstream>
 #include <absl/memory/memory.h>
 
 #include "absl/algorithm/container.h"
@@ -26,6 +26,27 @@
 #include "system_wrappers/include/field_trial.h"
 
 namespace wrtc {
+    // Keeps the peer tag of its remote candidate, so payload sent through it
+    // reaches ReflectorPort::SendTo without the hostname being parsed again
+    class ReflectorConnection final : public cricket::ProxyConnection {
+        uint32_t peerTag;
+
+    public:
+        ReflectorConnection(const rtc::WeakPtr<cricket::Port>& port, const cricket::Candidate& remoteCandidate, const uint32_t peerTag):
+            ProxyConnection(port, 0, remoteCandidate), peerTag(peerTag) {}
+
+        int Send(const void* data, const size_t size, const rtc::PacketOptions& options) override {
+            auto* reflectorPort = static_cast<ReflectorPort*>(port());
+            if (!reflectorPort) {
+                return ProxyConnection::Send(data, size, options);
+            }
+            reflectorPort->connectionPeerTag = peerTag;
+            const int result = ProxyConnection::Send(data, size, options);
+            reflectorPort->connectionPeerTag = 0;
+            return result;
+        }
+    };
+
     ReflectorPort::ReflectorPort(const cricket::CreateRelayPortArgs& args,
         rtc::AsyncPacketSocket* socket,
         const uint8_t serverId,
@@ -65,6 +86,7 @@ namespace wrtc {
             } while (!randomTag);
         }
         peerTag.AppendData(reinterpret_cast<uint8_t*>(&randomTag), 4);
+        sendBuffer.EnsureCapacity(SendBufferCapacity);
     }
 
     ReflectorPort::ReflectorPort(const cricket::CreateRelayPortArgs& args,
@@ -109,6 +131,7 @@ namespace wrtc {
             } while (!randomTag);
         }
         peerTag.AppendData(reinterpret_cast<uint8_t*>(&randomTag), 4);
+        sendBuffer.EnsureCapacity(SendBufferCapacity);
     }
 
     bool ReflectorPort::ready() const {
@@ -243,15 +266,14 @@ namespace wrtc {
             }
         } else if (serverAddress.proto == cricket::PROTO_TCP) {
             RTC_DCHECK(!SharedSocket());
-            constexpr int opts = rtc::PacketSocketFactory::OPT_STUN;
-            rtc::PacketSocketTcpOptions tcp_options;
-            tcp_options.opts = opts;
+            rtc::PacketSocketTcpOptions tcpOptions;
+            tcpOptions.opts = rtc::PacketSocketFactory::OPT_STUN;
             socket = socket_factory()->CreateClientTcpSocket(
                 rtc::SocketAddress(Network()->GetBestIP(), 0),
                 serverAddress.address,
-                get_proxy(),
-                get_user_agent(),
-                tcp_options
+                proxy(),
+                user_agent(),
+                tcpOptions
             );
         }
         if (!socket) {
@@ -310,19 +332,49 @@ namespace wrtc {
                 return;
             }
         }
-        state = STATE_CONNECTED;
+        if (state != STATE_READY) {
+            state = STATE_CONNECTED;
+        }
+        reconnectAttempts = 0;
         if (serverAddress.address.IsUnresolvedIP()) {
             serverAddress.address = socket->GetRemoteAddress();
         }
         RTC_LOG(LS_INFO) << "ReflectorPort connected to " << socket->GetRemoteAddress().ToSensitiveString() << " using tcp.";
+        SendReflectorHello();
     }
 
     void ReflectorPort::OnSocketClose(rtc::AsyncPacketSocket* socket, const int error) {
         RTC_LOG(LS_WARNING) << ToString() << ": Connection with server failed with error: " << error;
         RTC_DCHECK(socket == this->socket);
+        if (state != STATE_DISCONNECTED && reconnectAttempts < MaxReconnectAttempts) {
+            ScheduleReconnect();
+            return;
+        }
         Close();
     }
 
+    void ReflectorPort::ScheduleReconnect() {
+        socket->DeregisterReceivedPacketCallback();
+        socket->UnsubscribeCloseEvent(this);
+        socket->SignalReadyToSend.disconnect(this);
+        socket->SignalSentPacket.disconnect(this);
+        socket->SignalConnect.disconnect(this);
+        // The socket is still inside its own close callback, destroy it afterward
+        thread()->PostTask([closedSocket = std::unique_ptr<rtc::AsyncPacketSocket>(socket)] {});
+        socket = nullptr;
+
+        const auto delay = webrtc::TimeDelta::Millis(ReconnectDelayMs << reconnectAttempts++);
+        RTC_LOG(LS_INFO) << ToString() << ": Reconnecting to REFLECTOR server in " << delay.ms() << "ms";
+        thread()->PostDelayedTask(SafeTask(taskSafety.flag(), [this] {
+            if (state == STATE_DISCONNECTED) {
+                return;
+            }
+            if (!CreateReflectorClientSocket()) {
+                Close();
+            }
+        }), delay);
+    }
+
     cricket::Connection* ReflectorPort::CreateConnection(const cricket::Candidate& remote_candidate, CandidateOrigin origin) {
         if (!SupportsProtocol(remote_candidate.protocol())) {
             return nullptr;
@@ -335,13 +387,17 @@ namespace wrtc {
         if (!absl::StartsWith(remoteHostname, ipFormat) || !absl::EndsWith(remoteHostname, ".reflector")) {
             return nullptr;
         }
-        if (remote_candidate.address().port() != serverAddress.address.port()) {
+        if (state == STATE_DISCONNECTED || state == STATE_RECEIVEONLY) {
             return nullptr;
         }
-        if (state == STATE_DISCONNECTED || state == STATE_RECEIVEONLY) {
+        const uint32_t remoteTag = resolvePeerTag(remote_candidate.address());
+        if (!remoteTag) {
             return nullptr;
         }
-        auto* conn = new cricket::ProxyConnection(NewWeakPtr(), 0, remote_candidate);
+        // The same reflector is reachable over both transports, so either port
+        // relays towards candidates the peer allocated over the other one
+        senderAddresses.insert_or_assign(remoteTag, remote_candidate.address());
+        auto* conn = new ReflectorConnection(NewWeakPtr(), remote_candidate, remoteTag);
         AddOrReplaceConnection(conn);
         return conn;
     }
@@ -381,45 +437,59 @@ namespace wrtc {
         return error;
     }
 
-    int ReflectorPort::SendTo(const void* data, size_t size, const rtc::SocketAddress& addr, const rtc::PacketOptions& options, bool payload) {
-        rtc::CopyOnWriteBuffer targetPeerTag;
-        auto syntheticHostname = addr.hostname();
+    uint32_t ReflectorPort::resolvePeerTag(const rtc::SocketAddress& address) const {
+        const auto prefixFormat = "reflector-" + std::to_string(static_cast<uint32_t>(serverId)) + "-";
+        constexpr absl::string_view suffixFormat = ".reflector";
+        const absl::string_view syntheticHostname = address.hostname();
+        if (!absl::StartsWith(syntheticHostname, prefixFormat) || !absl::EndsWith(syntheticHostname, suffixFormat)) {
+            RTC_LOG(LS_ERROR) << ToString() << ": Discarding SendTo request with destination " << address.ToString();
+            return 0;
+        }
+        const auto tagString = syntheticHostname.substr(prefixFormat.size(), syntheticHostname.size() - suffixFormat.size() - prefixFormat.size());
         uint32_t resolvedPeerTag = 0;
-        if (auto resolvedPeerTagIt = resolvedPeerTagsByHostname.find(syntheticHostname); resolvedPeerTagIt != resolvedPeerTagsByHostname.end()) {
-            resolvedPeerTag = resolvedPeerTagIt->second;
-        } else {
-            const auto prefixFormat = "reflector-" + std::to_string(static_cast<uint32_t>(serverId)) + "-";
-            std::string suffixFormat = ".reflector";
-            if (!absl::StartsWith(syntheticHostname, prefixFormat) || !absl::EndsWith(syntheticHostname, suffixFormat)) {
-                RTC_LOG(LS_ERROR) << ToString() << ": Discarding SendTo request with destination " << addr.ToString();
-                return -1;
-            }
-            auto startPosition = prefixFormat.size();
-            auto tagString = syntheticHostname.substr(startPosition, syntheticHostname.size() - suffixFormat.size() - startPosition);
-            std::stringstream tagStringStream(tagString);
-            tagStringStream >> resolvedPeerTag;
-            if (resolvedPeerTag == 0) {
-                RTC_LOG(LS_ERROR) << ToString() << ": Discarding SendTo request with destination " << addr.ToString() << " (could not parse peer tag)";
-                return -1;
-            }
-            resolvedPeerTagsByHostname.insert(std::make_pair(syntheticHostname, resolvedPeerTag));
+        std::from_chars(tagString.data(), tagString.data() + tagString.size(), resolvedPeerTag);
+        if (resolvedPeerTag == 0) {
+            RTC_LOG(LS_ERROR) << ToString() << ": Discarding SendTo request with destination " << address.ToString() << " (could not parse peer tag)";
+            return 0;
         }
-        targetPeerTag.AppendData(peerTag.data(), peerTag.size() - 4);
-        targetPeerTag.AppendData(reinterpret_cast<uint8_t*>(&resolvedPeerTag), 4);
-
-        rtc::ByteBufferWriter bufferWriter;
-        bufferWriter.WriteBytes(targetPeerTag.data(), targetPeerTag.size());
-        bufferWriter.WriteBytes(reinterpret_cast<const uint8_t*>(&randomTag), 4);
+        return resolvedPeerTag;
+    }
 
-        bufferWriter.WriteUInt32(static_cast<uint32_t>(size));
-        bufferWriter.WriteBytes(static_cast<const uint8_t*>(data), size);
-        while (bufferWriter.Length() % 4 != 0) {
-            bufferWriter.WriteUInt8(0);
+    const rtc::SocketAddress& ReflectorPort::senderAddress(const uint32_t senderTag) {
+        if (const auto it = senderAddresses.find(senderTag); it != senderAddresses.end()) {
+            return it->second;
+        }
+        if (senderAddresses.size() >= MaxCachedPeerTags) {
+            senderAddresses.clear();
         }
+        const auto ipFormat = "reflector-" + std::to_string(static_cast<uint32_t>(serverId)) + "-" + std::to_string(senderTag) + ".reflector";
+        rtc::SocketAddress candidateAddress(ipFormat, serverAddress.address.port());
+        candidateAddress.SetResolvedIP(serverAddress.address.ipaddr());
+        return senderAddresses.emplace(senderTag, std::move(candidateAddress)).first->second;
+    }
+
+    int ReflectorPort::SendTo(const void* data, size_t size, const rtc::SocketAddress& addr, const rtc::PacketOptions& options, bool payload) {
+        // Payload arrives through a ReflectorConnection with its tag already
+        // resolved, only STUN pings still name the peer by hostname
+        const uint32_t resolvedPeerTag = connectionPeerTag ? connectionPeerTag : resolvePeerTag(addr);
+        if (resolvedPeerTag == 0) {
+            return -1;
+        }
+        const size_t headerSize = peerTag.size() + 8;
+        const size_t packetSize = (headerSize + size + 3) & ~static_cast<size_t>(3);
+        sendBuffer.SetSize(packetSize);
+        uint8_t* buffer = sendBuffer.data();
+        memcpy(buffer, peerTag.data(), peerTag.size() - 4);
+        memcpy(buffer + peerTag.size() - 4, &resolvedPeerTag, 4);
+        memcpy(buffer + peerTag.size(), &randomTag, 4);
+        rtc::SetBE32(buffer + peerTag.size() + 4, static_cast<uint32_t>(size));
+        memcpy(buffer + headerSize, data, size);
+        memset(buffer + headerSize + size, 0, packetSize - headerSize - size);
+
         rtc::PacketOptions modified_options(options);
         CopyPortInformationToPacketInfo(&modified_options.info_signaled_after_sent);
-        modified_options.info_signaled_after_sent.turn_overhead_bytes = bufferWriter.Length() - size;
-        (void) Send(bufferWriter.Data(), bufferWriter.Length(), modified_options);
+        modified_options.info_signaled_after_sent.turn_overhead_bytes = packetSize - size;
+        (void) Send(buffer, packetSize, modified_options);
         return static_cast<int>(size);
     }
 
@@ -516,14 +586,11 @@ namespace wrtc {
                     << ToString()
                     << ": Received data packet with invalid size tag";
                 } else {
-                    const auto ipFormat = "reflector-" + std::to_string(static_cast<uint32_t>(serverId)) + "-" + std::to_string(senderTag) + ".reflector";
-                    rtc::SocketAddress candidateAddress(ipFormat, serverAddress.address.port());
-                    candidateAddress.SetResolvedIP(serverAddress.address.ipaddr());
-                    int64_t packet_timestamp = -1;
-                    if (packet_time_us.has_value()) {
-                        packet_timestamp = packet_time_us->us_or(-1);
-                    }
-                    DispatchPacket(rtc::ReceivedPacket::CreateFromLegacy(data + 16 + 4 + 4, dataSize, packet_timestamp, candidateAddress));
+                    DispatchPacket(rtc::ReceivedPacket(
+                        rtc::MakeArrayView(data + 16 + 4 + 4, dataSize),
+                        senderAddress(senderTag),
+                        packet_time_us
+                    ));
                 }
             }
         }
@@ -582,7 +649,7 @@ namespace wrtc {
         CopyPortInformationToPacketInfo(&options.info_signaled_after_sent);
         if (Send(data, size, options) < 0) {
             RTC_LOG(LS_ERROR) << ToString() << ": Failed to send TURN message, error: "
-            << socket->GetError();
+            << (socket ? socket->GetError() : SOCKET_ERROR);
         }
     }
 
@@ -649,6 +716,9 @@ namespace wrtc {
     }
 
     int ReflectorPort::Send(const void* data, const size_t size, const rtc::PacketOptions& options) const {
+        if (!socket) {
+            return -1;
+        }
         return socket->SendTo(data, size, serverAddress.address, options);
     }
 
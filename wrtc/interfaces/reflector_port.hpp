@@ -8,9 +8,11 @@
 #include <p2p/client/basic_port_allocator.h>
 #include <api/async_dns_resolver.h>
 #include <rtc_base/async_packet_socket.h>
+#include <rtc_base/buffer.h>
+#include <unordered_map>
 
 namespace wrtc {
-
+    class ReflectorConnection;
 
     class ReflectorPort final : public cricket::Port {
     public:
@@ -104,9 +106,16 @@ namespace wrtc {
         rtc::DiffServCodePoint StunDscpValue() const override;
 
     private:
+        friend class ReflectorConnection;
+
         typedef std::map<rtc::Socket::Option, int> SocketOptionsMap;
         typedef std::set<rtc::SocketAddress> AttemptedServerSet;
 
+        static constexpr size_t MaxCachedPeerTags = 256;
+        static constexpr size_t SendBufferCapacity = 2048;
+        static constexpr int MaxReconnectAttempts = 3;
+        static constexpr int ReconnectDelayMs = 250;
+
         rtc::CopyOnWriteBuffer peerTag;
         uint32_t randomTag = 0;
         cricket::ProtocolAddress serverAddress;
@@ -121,11 +130,14 @@ namespace wrtc {
         PortState state;
         AttemptedServerSet attemptedServerAddresses;
         bool isRunningPingTask = false;
+        int reconnectAttempts = 0;
         bool standaloneReflectorMode;
         uint32_t standaloneReflectorRoleId;
 
         rtc::DiffServCodePoint stunDscpValue;
-        std::map<std::string, uint32_t> resolvedPeerTagsByHostname;
+        uint32_t connectionPeerTag = 0;
+        std::unordered_map<uint32_t, rtc::SocketAddress> senderAddresses;
+        rtc::Buffer sendBuffer;
         cricket::RelayCredentials credentials;
         int serverPriority;
 
@@ -145,12 +157,18 @@ namespace wrtc {
 
         void OnSocketClose(rtc::AsyncPacketSocket* socket, int error);
 
+        void ScheduleReconnect();
+
         void Release();
 
         void SendReflectorHello();
 
         void DispatchPacket(const rtc::ReceivedPacket& packet);
 
+        uint32_t resolvePeerTag(const rtc::SocketAddress& address) const;
+
+        const rtc::SocketAddress& senderAddress(uint32_t senderTag);
+
         static rtc::CopyOnWriteBuffer parseHex(std::string const &string);
 
         bool FailAndPruneConnection(const rtc::SocketAddress& address);
@@ -10,12 +10,18 @@
 namespace wrtc {
     ReflectorRelayPortFactory::ReflectorRelayPortFactory(const std::vector<RTCServer>& servers,
         const bool standaloneReflectorMode,
-        const uint32_t standaloneReflectorRoleId):
+        const uint32_t standaloneReflectorRoleId,
+        rtc::PacketSocketFactory* socketFactory):
     servers(servers),
     standaloneReflectorMode(standaloneReflectorMode),
-    standaloneReflectorRoleId(standaloneReflectorRoleId) {}
+    standaloneReflectorRoleId(standaloneReflectorRoleId),
+    socketFactory(socketFactory) {}
 
     std::unique_ptr<cricket::Port> ReflectorRelayPortFactory::Create(const cricket::CreateRelayPortArgs& args, rtc::AsyncPacketSocket* udp_socket) {
+        if (socketFactory) {
+            // The allocator's shared socket is multiplexed, relay ports get a plain one of their own
+            return Create(args, 0, 0);
+        }
         if (args.config->credentials.username == "reflector") {
             uint8_t foundId = 0;
             for (const auto & [id, host, port, login, password, isTurn, isTcp] : servers) {
@@ -43,6 +49,12 @@ namespace wrtc {
     }
 
     std::unique_ptr<cricket::Port> ReflectorRelayPortFactory::Create(const cricket::CreateRelayPortArgs& args, const int min_port, const int max_port) {
+        // Relay allocations are keyed by their 5-tuple on the server side,
+        // so they never go through a multiplexed socket factory
+        auto relayArgs = args;
+        if (socketFactory) {
+            relayArgs.socket_factory = socketFactory;
+        }
         if (args.config->credentials.username == "reflector") {
             uint8_t foundId = 0;
             for (const auto & [id, host, port, login, password, isTurn, isTcp] : servers) {
@@ -54,13 +66,13 @@ namespace wrtc {
             if (foundId == 0) {
                 return nullptr;
             }
-            auto port = ReflectorPort::Create(args, min_port, max_port, foundId, args.relative_priority, standaloneReflectorMode, standaloneReflectorRoleId);
+            auto port = ReflectorPort::Create(relayArgs, min_port, max_port, foundId, args.relative_priority, standaloneReflectorMode, standaloneReflectorRoleId);
             if (!port) {
                 return nullptr;
             }
             return port;
         }
-        auto port = cricket::TurnPort::Create(args, min_port, max_port);
+        auto port = cricket::TurnPort::Create(relayArgs, min_port, max_port);
         if (!port) {
             return nullptr;
         }
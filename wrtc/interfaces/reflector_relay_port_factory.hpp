@@ -14,8 +14,9 @@ namespace wrtc {
         std::vector<RTCServer> servers;
         bool standaloneReflectorMode;
         uint32_t standaloneReflectorRoleId;
+        rtc::PacketSocketFactory* socketFactory;
     public:
-        explicit ReflectorRelayPortFactory(const std::vector<RTCServer>& servers, bool standaloneReflectorMode, uint32_t standaloneReflectorRoleId);
+        explicit ReflectorRelayPortFactory(const std::vector<RTCServer>& servers, bool standaloneReflectorMode, uint32_t standaloneReflectorRoleId, rtc::PacketSocketFactory* socketFactory = nullptr);
 
         ~ReflectorRelayPortFactory() override = default;
 
@@ -0,0 +1,15 @@
+//
+// Created by Laky64 on 23/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace wrtc {
+    struct BandwidthStats {
+        int64_t sendBandwidth = 0;
+        double fractionLost = 0;
+        double rttMs = 0;
+    };
+} // wrtc
@@ -0,0 +1,37 @@
+//
+// Created by Laky64 on 17/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace wrtc {
+    struct CandidatePairStats {
+        std::string localAddress;
+        std::string localType;
+        std::string remoteAddress;
+        std::string remoteType;
+        std::string protocol;
+    };
+
+    struct CallStats {
+        int64_t sendBandwidth = 0;
+        int64_t recvBandwidth = 0;
+        uint64_t bytesSent = 0;
+        uint64_t bytesReceived = 0;
+        uint64_t packetsSent = 0;
+        uint64_t packetsReceived = 0;
+        int64_t packetsLost = 0;
+        double fractionLost = 0;
+        double rttMs = 0;
+        double jitterMs = 0;
+        double pacingJitterMs = 0;
+        uint64_t framesEncoded = 0;
+        double totalEncodeTimeMs = 0;
+        uint64_t framesDropped = 0;
+        std::optional<CandidatePairStats> candidatePair;
+    };
+} // wrtc
@@ -6,7 +6,6 @@
 
 #include <media/base/media_engine.h>
 #include <p2p/base/transport_description.h>
-#include <rtc_base/rtc_certificate_generator.h>
 #include <pc/webrtc_session_description_factory.h>
 
 #include "wrtc/exceptions.hpp"
@@ -16,14 +15,14 @@ namespace wrtc {
         const webrtc::FieldTrialsView& fieldTrials,
         const bool isOutgoing,
         cricket::MediaEngineInterface *mediaEngine,
-        rtc::UniqueRandomIdGenerator *uniqueRandomIdGenerator
+        rtc::UniqueRandomIdGenerator *uniqueRandomIdGenerator,
+        const rtc::scoped_refptr<rtc::RTCCertificate>& placeholderCertificate
     ) :isOutgoing(isOutgoing), uniqueRandomIdGenerator(uniqueRandomIdGenerator) {
         transportDescriptionFactory = std::make_unique<cricket::TransportDescriptionFactory>(fieldTrials);
-        const auto tempCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(
-            rtc::KeyParams(rtc::KT_ECDSA),
-            absl::nullopt
-        );
-        transportDescriptionFactory->set_certificate(tempCertificate);
+        transportDescriptionFactory->set_certificate(placeholderCertificate);
+        if (placeholderCertificate) {
+            placeholderFingerprint = rtc::SSLFingerprint::CreateFromCertificate(*placeholderCertificate.get());
+        }
         sessionDescriptionFactory = std::make_unique<cricket::MediaSessionDescriptionFactory>(
             mediaEngine,
             true,
@@ -239,11 +238,6 @@ namespace wrtc {
                 if (std::to_string(channel.ssrc) == id) {
                     found = true;
                     auto mappedContent = convertSignalingContentToContentInfo(std::to_string(channel.ssrc), channel, webrtc::RtpTransceiverDirection::kRecvOnly);
-                    auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                    std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                    if (localCertificate) {
-                        fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                    }
                     std::vector<std::string> transportOptions;
                     cricket::TransportDescription transportDescription(
                         transportOptions,
@@ -251,7 +245,7 @@ namespace wrtc {
                         "pwd",
                         cricket::IceMode::ICEMODE_FULL,
                         cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                        fingerprint.get()
+                        placeholderFingerprint.get()
                     );
                     cricket::TransportInfo transportInfo(std::to_string(channel.ssrc), transportDescription);
                     sessionDescription->AddTransportInfo(transportInfo);
@@ -263,11 +257,6 @@ namespace wrtc {
                 if (channel.id == id) {
                     found = true;
                     auto mappedContent = convertSignalingContentToContentInfo(channel.id, channel.content, webrtc::RtpTransceiverDirection::kSendOnly);
-                    auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                    std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                    if (localCertificate) {
-                        fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                    }
                     std::vector<std::string> transportOptions;
                     cricket::TransportDescription transportDescription(
                         transportOptions,
@@ -275,7 +264,7 @@ namespace wrtc {
                         "pwd",
                         cricket::IceMode::ICEMODE_FULL,
                         cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                        fingerprint.get()
+                        placeholderFingerprint.get()
                     );
                     cricket::TransportInfo transportInfo(mappedContent.name, transportDescription);
                     sessionDescription->AddTransportInfo(transportInfo);
@@ -286,11 +275,6 @@ namespace wrtc {
 
             if (!found) {
                 auto mappedContent = createInactiveContentInfo("_" + id);
-                auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                if (localCertificate) {
-                    fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                }
                 std::vector<std::string> transportOptions;
                 cricket::TransportDescription transportDescription(
                     transportOptions,
@@ -298,7 +282,7 @@ namespace wrtc {
                     "pwd",
                     cricket::IceMode::ICEMODE_FULL,
                     cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                    fingerprint.get()
+                    placeholderFingerprint.get()
                 );
                 cricket::TransportInfo transportInfo(mappedContent.name, transportDescription);
                 sessionDescription->AddTransportInfo(transportInfo);
@@ -510,11 +494,6 @@ namespace wrtc {
                         contentDescription.header_extensions.emplace_back(extension.uri, extension.id);
                     }
                     answerOptions.media_description_options.push_back(contentDescription);
-                    auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                    std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                    if (localCertificate) {
-                        fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                    }
                     std::vector<std::string> transportOptions;
                     cricket::TransportDescription transportDescription(
                         transportOptions,
@@ -522,7 +501,7 @@ namespace wrtc {
                         "pwd",
                         cricket::IceMode::ICEMODE_FULL,
                         cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                        fingerprint.get()
+                        placeholderFingerprint.get()
                     );
                     cricket::TransportInfo transportInfo(channel.id, transportDescription);
                     mappedOffer->AddTransportInfo(transportInfo);
@@ -539,11 +518,6 @@ namespace wrtc {
                         contentDescription.header_extensions.emplace_back(extension.uri, extension.id);
                     }
                     answerOptions.media_description_options.push_back(contentDescription);
-                    auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                    std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                    if (localCertificate) {
-                        fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                    }
                     std::vector<std::string> transportOptions;
                     cricket::TransportDescription transportDescription(
                         transportOptions,
@@ -551,7 +525,7 @@ namespace wrtc {
                         "pwd",
                         cricket::IceMode::ICEMODE_FULL,
                         cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                        fingerprint.get()
+                        placeholderFingerprint.get()
                     );
                     cricket::TransportInfo transportInfo(mappedContent.mid(), transportDescription);
                     mappedOffer->AddTransportInfo(transportInfo);
@@ -563,11 +537,6 @@ namespace wrtc {
                 auto mappedContent = createInactiveContentInfo("_" + id);
                 cricket::MediaDescriptionOptions contentDescription(cricket::MediaType::MEDIA_TYPE_AUDIO, "_" + id, webrtc::RtpTransceiverDirection::kInactive, false);
                 answerOptions.media_description_options.push_back(contentDescription);
-                auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                if (localCertificate) {
-                    fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                }
                 std::vector<std::string> transportOptions;
                 cricket::TransportDescription transportDescription(
                     transportOptions,
@@ -575,7 +544,7 @@ namespace wrtc {
                     "pwd",
                     cricket::IceMode::ICEMODE_FULL,
                     cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                    fingerprint.get()
+                    placeholderFingerprint.get()
                 );
                 cricket::TransportInfo transportInfo(mappedContent.mid(), transportDescription);
                 mappedOffer->AddTransportInfo(transportInfo);
@@ -587,11 +556,6 @@ namespace wrtc {
                 channelIdOrder.push_back(std::to_string(content.ssrc));
                 answerOptions.media_description_options.push_back(getIncomingContentDescription(content));
                 auto mappedContent = convertSignalingContentToContentInfo(std::to_string(content.ssrc), content, webrtc::RtpTransceiverDirection::kSendOnly);
-                auto localCertificate = rtc::RTCCertificateGenerator::GenerateCertificate(rtc::KeyParams(rtc::KT_ECDSA), absl::nullopt);
-                std::unique_ptr<rtc::SSLFingerprint> fingerprint;
-                if (localCertificate) {
-                    fingerprint = rtc::SSLFingerprint::CreateFromCertificate(*localCertificate.get());
-                }
 
                 std::vector<std::string> transportOptions;
                 cricket::TransportDescription transportDescription(
@@ -600,7 +564,7 @@ namespace wrtc {
                     "pwd",
                     cricket::IceMode::ICEMODE_FULL,
                     cricket::ConnectionRole::CONNECTIONROLE_ACTPASS,
-                    fingerprint.get()
+                    placeholderFingerprint.get()
                 );
                 cricket::TransportInfo transportInfo(mappedContent.mid(), transportDescription);
                 mappedOffer->AddTransportInfo(transportInfo);
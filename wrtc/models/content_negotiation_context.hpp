@@ -4,6 +4,8 @@
 
 #pragma once
 #include <p2p/base/transport_description_factory.h>
+#include <rtc_base/rtc_certificate.h>
+#include <rtc_base/ssl_fingerprint.h>
 #include <rtc_base/unique_id_generator.h>
 #include <pc/media_session.h>
 
@@ -49,6 +51,7 @@ namespace wrtc {
         rtc::UniqueRandomIdGenerator* uniqueRandomIdGenerator;
         std::unique_ptr<cricket::TransportDescriptionFactory> transportDescriptionFactory;
         std::unique_ptr<cricket::MediaSessionDescriptionFactory> sessionDescriptionFactory;
+        std::unique_ptr<rtc::SSLFingerprint> placeholderFingerprint;
         std::vector<webrtc::RtpHeaderExtensionCapability> rtpAudioExtensions;
         std::vector<webrtc::RtpHeaderExtensionCapability> rtpVideoExtensions;
         std::vector<PendingOutgoingChannel> outgoingChannelDescriptions;
@@ -77,7 +80,8 @@ namespace wrtc {
             const webrtc::FieldTrialsView& fieldTrials,
             bool isOutgoing,
             cricket::MediaEngineInterface *mediaEngine,
-            rtc::UniqueRandomIdGenerator *uniqueRandomIdGenerator
+            rtc::UniqueRandomIdGenerator *uniqueRandomIdGenerator,
+            const rtc::scoped_refptr<rtc::RTCCertificate>& placeholderCertificate
         );
 
         void copyCodecsFromChannelManager(cricket::MediaEngineInterface *mediaEngine, bool randomize);
@@ -0,0 +1,14 @@
+//
+// Created by Laky64 on 15/09/2024.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace wrtc {
+    struct EncoderStats {
+        uint64_t framesEncoded = 0;
+        double totalEncodeTimeMs = 0;
+    };
+} // wrtc
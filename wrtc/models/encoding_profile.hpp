@@ -0,0 +1,41 @@
+//
+// Created by Laky64 on 14/09/2024.
+//
+
+#pragma once
+
+#include <optional>
+
+namespace wrtc {
+    constexpr auto kCodecParamComplexity = "x-ntg-complexity";
+
+    struct AudioEncodingProfile {
+        int bitrate = 32 * 1024;
+        int ptime = 60;
+        std::optional<int> complexity;
+        bool fec = true;
+        bool dtx = false;
+
+        bool operator==(const AudioEncodingProfile& rhs) const = default;
+    };
+
+    struct VideoEncodingProfile {
+        enum class Speed {
+            Default,
+            Fast,
+            Balanced,
+            Quality,
+        };
+
+        std::optional<int> minBitrate;
+        std::optional<int> maxBitrate;
+        std::optional<double> maxFramerate;
+        std::optional<double> scaleResolutionDownBy;
+        bool screencast = false;
+        Speed speed = Speed::Default;
+        // Send VP8 instead of AV1 when both were negotiated, AV1 costs far more to encode
+        bool lightweightCodec = false;
+
+        bool operator==(const VideoEncodingProfile& rhs) const = default;
+    };
+} // wrtc
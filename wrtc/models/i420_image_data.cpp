@@ -4,6 +4,8 @@
 
 #include "i420_image_data.hpp"
 
+#include <libyuv/scale.h>
+
 namespace wrtc {
     size_t i420ImageData::sizeOfLuminancePlane() const {
         return static_cast<size_t>(width * height);
@@ -42,4 +44,20 @@ namespace wrtc {
         memcpy(buffer->MutableDataV(), dataV(), sizeOfChromaPlane());
         return buffer;
     }
+
+    rtc::scoped_refptr<webrtc::I420Buffer> i420ImageData::scaledBuffer(const uint16_t targetWidth, const uint16_t targetHeight) const {
+        auto buffer = webrtc::I420Buffer::Create(targetWidth, targetHeight);
+        libyuv::I420Scale(
+            dataY(), width,
+            dataU(), width / 2,
+            dataV(), width / 2,
+            width, height,
+            buffer->MutableDataY(), buffer->StrideY(),
+            buffer->MutableDataU(), buffer->StrideU(),
+            buffer->MutableDataV(), buffer->StrideV(),
+            targetWidth, targetHeight,
+            libyuv::kFilterBox
+        );
+        return buffer;
+    }
 }
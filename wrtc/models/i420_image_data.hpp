@@ -32,5 +32,7 @@ namespace wrtc {
         ~i420ImageData();
 
         [[nodiscard]] rtc::scoped_refptr<webrtc::I420Buffer> buffer() const;
+
+        [[nodiscard]] rtc::scoped_refptr<webrtc::I420Buffer> scaledBuffer(uint16_t targetWidth, uint16_t targetHeight) const;
     };
 }
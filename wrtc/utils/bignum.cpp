@@ -4,6 +4,10 @@
 
 #include "bignum.hpp"
 
+#include <map>
+#include <mutex>
+#include <utility>
+
 namespace openssl {
     void BigNum::clear() const {
         BN_clear_free(std::exchange(_data, nullptr));
@@ -54,6 +58,20 @@ namespace openssl {
         }
     }
 
+    void BigNum::setModExp(const BigNum& base, const BigNum& power, const MontgomeryContext& m, const Context &context) const {
+        if (base.failed() || power.failed() || m.failed()) {
+            _failed = true;
+        } else if (base.isNegative() || power.isNegative()) {
+            _failed = true;
+        } else if (!BN_mod_exp_mont_consttime(raw(), base.raw(), power.raw(), m.modulus().raw(), context.raw(), m.raw())) {
+            _failed = true;
+        } else if (isNegative()) {
+            _failed = true;
+        } else {
+            _failed = false;
+        }
+    }
+
     void BigNum::setSub(const BigNum& a, const BigNum& b) const {
         if (a.failed() || b.failed()) {
             _failed = true;
@@ -110,4 +128,60 @@ namespace openssl {
         BN_bn2bin(raw(), reinterpret_cast<unsigned char*>(result.data()));
         return result;
     }
+
+    MontgomeryContext::MontgomeryContext(const bytes::const_span modulus): _modulus(modulus) {
+        if (_modulus.failed() || _modulus.isZero() || _modulus.isNegative() || !BN_is_odd(_modulus.raw())) {
+            return;
+        }
+        const auto &context = Context::Local();
+        _data = BN_MONT_CTX_new();
+        if (_data && !BN_MONT_CTX_set(_data, _modulus.raw(), context.raw())) {
+            BN_MONT_CTX_free(std::exchange(_data, nullptr));
+        }
+        if (!_data) {
+            return;
+        }
+        const auto half = BigNum();
+        _safePrime = BN_rshift1(half.raw(), _modulus.raw())
+            && BN_is_prime_ex(_modulus.raw(), BN_prime_checks, context.raw(), nullptr) == 1
+            && BN_is_prime_ex(half.raw(), BN_prime_checks, context.raw(), nullptr) == 1;
+    }
+
+    MontgomeryContext::~MontgomeryContext() {
+        if (_data) {
+            BN_MONT_CTX_free(_data);
+        }
+    }
+
+    const BigNum& MontgomeryContext::modulus() const {
+        return _modulus;
+    }
+
+    BN_MONT_CTX* MontgomeryContext::raw() const {
+        return _data;
+    }
+
+    bool MontgomeryContext::failed() const {
+        return !_data;
+    }
+
+    bool MontgomeryContext::isSafePrime() const {
+        return _safePrime;
+    }
+
+    std::shared_ptr<const MontgomeryContext> MontgomeryContext::Cached(const bytes::const_span modulus) {
+        static std::mutex mutex;
+        static std::map<bytes::vector, std::shared_ptr<const MontgomeryContext>> contexts;
+        auto key = bytes::vector(modulus.begin(), modulus.end());
+        std::lock_guard lock(mutex);
+        if (const auto it = contexts.find(key); it != contexts.end()) {
+            return it->second;
+        }
+        if (contexts.size() >= kMaxCached) {
+            contexts.clear();
+        }
+        auto context = std::make_shared<const MontgomeryContext>(modulus);
+        contexts.emplace(std::move(key), context);
+        return context;
+    }
 } // openssl
\ No newline at end of file
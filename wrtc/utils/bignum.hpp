@@ -5,6 +5,7 @@
 #pragma once
 
 #include <openssl/bn.h>
+#include <memory>
 #include "binary.hpp"
 
 namespace openssl {
@@ -23,10 +24,18 @@ namespace openssl {
         [[nodiscard]] BN_CTX *raw() const {
             return _data;
         }
+
+        // BN_CTX is not thread safe, so every thread keeps its own scratch pool
+        static const Context &Local() {
+            thread_local const Context context;
+            return context;
+        }
     private:
         BN_CTX *_data = nullptr;
     };
 
+    class MontgomeryContext;
+
     class BigNum {
         mutable BIGNUM *_data = nullptr;
         mutable bool _failed = false;
@@ -49,7 +58,9 @@ namespace openssl {
 
         uint32_t bytesSize() const;
 
-        void setModExp(const BigNum &base, const BigNum &power, const BigNum &m, const Context &context = Context()) const;
+        void setModExp(const BigNum &base, const BigNum &power, const BigNum &m, const Context &context = Context::Local()) const;
+
+        void setModExp(const BigNum &base, const BigNum &power, const MontgomeryContext &m, const Context &context = Context::Local()) const;
 
         bool failed() const;
 
@@ -65,4 +76,30 @@ namespace openssl {
 
         void setSub(const BigNum &a, const BigNum &b) const;
     };
+
+    // Montgomery form of a modulus, computed once and shared by every exponentiation against it
+    class MontgomeryContext {
+        static constexpr size_t kMaxCached = 4;
+
+        BigNum _modulus;
+        BN_MONT_CTX *_data = nullptr;
+        bool _safePrime = false;
+    public:
+        explicit MontgomeryContext(bytes::const_span modulus);
+
+        MontgomeryContext(const MontgomeryContext &other) = delete;
+
+        ~MontgomeryContext();
+
+        [[nodiscard]] const BigNum &modulus() const;
+
+        [[nodiscard]] BN_MONT_CTX *raw() const;
+
+        [[nodiscard]] bool failed() const;
+
+        // Primality of both p and (p - 1) / 2, checked when the context is built
+        [[nodiscard]] bool isSafePrime() const;
+
+        static std::shared_ptr<const MontgomeryContext> Cached(bytes::const_span modulus);
+    };
 } // openssl
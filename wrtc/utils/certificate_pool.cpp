@@ -0,0 +1,130 @@
+//
+// Created by Laky64 on 21/09/2024.
+//
+
+#include "certificate_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <rtc_base/logging.h>
+#include <rtc_base/ref_counted_object.h>
+#include <rtc_base/rtc_certificate_generator.h>
+#include <rtc_base/time_utils.h>
+
+namespace wrtc {
+    std::mutex CertificatePool::_mutex{};
+    int CertificatePool::_references = 0;
+    rtc::scoped_refptr<CertificatePool> CertificatePool::_default = nullptr;
+    std::atomic<size_t> CertificatePool::_size = 4;
+    std::atomic<int64_t> CertificatePool::_rotationMs = 60 * 60 * 1000;
+
+    CertificatePool::CertificatePool() {
+        thread = std::thread([this] {
+            run();
+        });
+    }
+
+    CertificatePool::~CertificatePool() {
+        {
+            std::lock_guard lock(mutex);
+            running = false;
+        }
+        cv.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    rtc::scoped_refptr<CertificatePool> CertificatePool::GetOrCreateDefault() {
+        std::lock_guard lock(_mutex);
+        _references++;
+        if (_references == 1) {
+            _default = rtc::scoped_refptr<CertificatePool>(new rtc::RefCountedObject<CertificatePool>());
+        }
+        return _default;
+    }
+
+    void CertificatePool::UnRef() {
+        std::lock_guard lock(_mutex);
+        _references--;
+        if (!_references) {
+            _default = nullptr;
+        }
+    }
+
+    void CertificatePool::Configure(const size_t size, const webrtc::TimeDelta rotation) {
+        _size = size;
+        _rotationMs = std::max<int64_t>(rotation.ms(), 1000);
+        std::lock_guard lock(_mutex);
+        if (_default) {
+            _default->cv.notify_all();
+        }
+    }
+
+    rtc::scoped_refptr<rtc::RTCCertificate> CertificatePool::take() {
+        {
+            std::lock_guard lock(mutex);
+            const auto now = rtc::TimeMillis();
+            while (!certificates.empty()) {
+                auto entry = std::move(certificates.front());
+                certificates.pop_front();
+                if (!expired(entry, now)) {
+                    cv.notify_all();
+                    return entry.certificate;
+                }
+            }
+            cv.notify_all();
+        }
+        RTC_LOG(LS_VERBOSE) << "Certificate pool is empty, generating inline";
+        return Generate();
+    }
+
+    rtc::scoped_refptr<rtc::RTCCertificate> CertificatePool::placeholder() {
+        std::lock_guard lock(mutex);
+        if (!placeholderEntry.certificate || expired(placeholderEntry, rtc::TimeMillis())) {
+            if (!certificates.empty()) {
+                placeholderEntry = std::move(certificates.front());
+                certificates.pop_front();
+                cv.notify_all();
+            } else {
+                placeholderEntry = {Generate(), rtc::TimeMillis()};
+            }
+        }
+        return placeholderEntry.certificate;
+    }
+
+    rtc::scoped_refptr<rtc::RTCCertificate> CertificatePool::Generate() {
+        return rtc::RTCCertificateGenerator::GenerateCertificate(
+            rtc::KeyParams(rtc::KT_ECDSA),
+            absl::nullopt
+        );
+    }
+
+    bool CertificatePool::expired(const Entry& entry, const int64_t now) const {
+        return now - entry.createdMs >= _rotationMs;
+    }
+
+    void CertificatePool::run() {
+        std::unique_lock lock(mutex);
+        while (running) {
+            const auto now = rtc::TimeMillis();
+            while (!certificates.empty() && expired(certificates.front(), now)) {
+                certificates.pop_front();
+            }
+            if (certificates.size() < _size) {
+                lock.unlock();
+                auto certificate = Generate();
+                lock.lock();
+                if (certificate) {
+                    certificates.push_back({std::move(certificate), rtc::TimeMillis()});
+                } else {
+                    RTC_LOG(LS_WARNING) << "Failed to generate pooled certificate";
+                    cv.wait_for(lock, std::chrono::milliseconds(RetryDelayMs));
+                }
+                continue;
+            }
+            const auto wait = certificates.empty() ? _rotationMs.load() : certificates.front().createdMs + _rotationMs - now;
+            cv.wait_for(lock, std::chrono::milliseconds(wait));
+        }
+    }
+} // wrtc
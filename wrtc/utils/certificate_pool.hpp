@@ -0,0 +1,66 @@
+//
+// Created by Laky64 on 21/09/2024.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <api/ref_count.h>
+#include <api/scoped_refptr.h>
+#include <api/units/time_delta.h>
+#include <rtc_base/rtc_certificate.h>
+
+namespace wrtc {
+
+    // Keeps ECDSA certificates generated ahead of time by a background thread,
+    // so that key generation never happens on the call setup path. Pooled
+    // certificates are handed out once and discarded after the rotation period.
+    class CertificatePool final : public webrtc::RefCountInterface {
+    public:
+        CertificatePool();
+
+        ~CertificatePool() override;
+
+        static rtc::scoped_refptr<CertificatePool> GetOrCreateDefault();
+
+        static void UnRef();
+
+        static void Configure(size_t size, webrtc::TimeDelta rotation);
+
+        rtc::scoped_refptr<rtc::RTCCertificate> take();
+
+        rtc::scoped_refptr<rtc::RTCCertificate> placeholder();
+
+    private:
+        struct Entry {
+            rtc::scoped_refptr<rtc::RTCCertificate> certificate;
+            int64_t createdMs = 0;
+        };
+
+        static constexpr int64_t RetryDelayMs = 1000;
+
+        static std::mutex _mutex;
+        static int _references;
+        static rtc::scoped_refptr<CertificatePool> _default;
+        static std::atomic<size_t> _size;
+        static std::atomic<int64_t> _rotationMs;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+        bool running = true;
+        std::deque<Entry> certificates;
+        Entry placeholderEntry;
+
+        static rtc::scoped_refptr<rtc::RTCCertificate> Generate();
+
+        bool expired(const Entry& entry, int64_t now) const;
+
+        void run();
+    };
+
+} // wrtc
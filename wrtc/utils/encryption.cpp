@@ -4,10 +4,28 @@
 
 #include "encryption.hpp"
 
-#include <openssl/aes.h>
-#include <climits>
+#include <cassert>
+#include <cstring>
 
 namespace openssl {
+    Sha256::Context::Context(): _data(EVP_MD_CTX_new()) {}
+
+    Sha256::Context::~Context() {
+        if (_data) {
+            EVP_MD_CTX_free(_data);
+        }
+    }
+
+    std::array<uint8_t, kSha256Size> Sha256::Context::concat(const bytes::memory_span& first, const bytes::memory_span& second) const {
+        auto result = std::array<uint8_t, kSha256Size>();
+        // Re-initialising with the same digest reuses the state allocated the first time
+        EVP_DigestInit_ex(_data, EVP_sha256(), nullptr);
+        EVP_DigestUpdate(_data, first.data, first.size);
+        EVP_DigestUpdate(_data, second.data, second.size);
+        EVP_DigestFinal_ex(_data, result.data(), nullptr);
+        return result;
+    }
+
     bytes::vector Sha256::Digest(const bytes::const_span data) {
         auto bytes = bytes::vector(SHA256_DIGEST_LENGTH);
         SHA256(reinterpret_cast<const unsigned char*>(data.data()), data.size(), reinterpret_cast<unsigned char*>(bytes.data()));
@@ -15,13 +33,8 @@ namespace openssl {
     }
 
     std::array<uint8_t, kSha256Size> Sha256::Concat(const bytes::memory_span& first, const bytes::memory_span& second) {
-        auto result = std::array<uint8_t, kSha256Size>();
-        auto context = SHA256_CTX();
-        SHA256_Init(&context);
-        SHA256_Update(&context, first.data, first.size);
-        SHA256_Update(&context, second.data, second.size);
-        SHA256_Final(result.data(), &context);
-        return result;
+        thread_local const Context context;
+        return context.concat(first, second);
     }
 
     bytes::vector Sha1::Digest(const bytes::const_span data) {
@@ -30,13 +43,44 @@ namespace openssl {
         return bytes;
     }
 
+    Aes::Context::Context(): _data(EVP_CIPHER_CTX_new()) {
+        if (_data) {
+            EVP_EncryptInit_ex(_data, EVP_aes_256_ctr(), nullptr, nullptr, nullptr);
+        }
+    }
+
+    Aes::Context::~Context() {
+        if (_data) {
+            EVP_CIPHER_CTX_free(_data);
+        }
+    }
+
+    void Aes::Context::processCtr(const bytes::memory_span from, void *to, const KeyIv& keyIv) const {
+        // Passing no cipher keeps the bound AES-256-CTR state instead of reallocating it
+        EVP_EncryptInit_ex(_data, nullptr, nullptr, keyIv.key.data(), keyIv.iv.data());
+        auto outLength = 0;
+        EVP_EncryptUpdate(
+            _data,
+            static_cast<uint8_t*>(to),
+            &outLength,
+            static_cast<const uint8_t*>(from.data),
+            static_cast<int>(from.size)
+        );
+        assert(static_cast<size_t>(outLength) == from.size);
+    }
+
     Aes::KeyIv Aes::PrepareKeyIv(const uint8_t* key, const uint8_t* msgKey, const int x) {
+        thread_local const Sha256::Context digest;
+        return PrepareKeyIv(digest, key, msgKey, x);
+    }
+
+    Aes::KeyIv Aes::PrepareKeyIv(const Sha256::Context& digest, const uint8_t* key, const uint8_t* msgKey, const int x) {
         auto result = KeyIv();
-        const auto sha256a = Sha256::Concat(
+        const auto sha256a = digest.concat(
             bytes::memory_span(msgKey, 16),
             bytes::memory_span(key + x, 36)
         );
-        const auto sha256b = Sha256::Concat(
+        const auto sha256b = digest.concat(
             bytes::memory_span(key + 40 + x, 36),
             bytes::memory_span(msgKey, 16)
         );
@@ -51,19 +95,8 @@ namespace openssl {
         return result;
     }
 
-    void Aes::ProcessCtr(const bytes::memory_span from, void *to, KeyIv& keyIv) {
-        auto aes = AES_KEY();
-        AES_set_encrypt_key(keyIv.key.data(), keyIv.key.size() * CHAR_BIT, &aes);
-        uint8_t ecountBuf[16] = {};
-        uint32_t offsetInBlock = 0;
-        AES_ctr128_encrypt(
-            static_cast<const unsigned char*>(from.data),
-            static_cast<unsigned char*>(to),
-            from.size,
-            &aes,
-            keyIv.iv.data(),
-            ecountBuf,
-            &offsetInBlock
-        );
+    void Aes::ProcessCtr(const bytes::memory_span from, void *to, const KeyIv& keyIv) {
+        thread_local const Context context;
+        context.processCtr(from, to, keyIv);
     }
-} // openssl
\ No newline at end of file
+} // openssl
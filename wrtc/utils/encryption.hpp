@@ -4,6 +4,7 @@
 #pragma once
 
 #include "binary.hpp"
+#include <openssl/evp.h>
 #include <openssl/sha.h>
 #include <array>
 
@@ -12,6 +13,21 @@ namespace openssl {
 
     class Sha256 {
     public:
+        // Digest state reset in place for every message instead of being allocated again
+        class Context {
+        public:
+            Context();
+
+            Context(const Context &other) = delete;
+
+            ~Context();
+
+            [[nodiscard]] std::array<uint8_t, kSha256Size> concat(const bytes::memory_span& first, const bytes::memory_span& second) const;
+
+        private:
+            EVP_MD_CTX *_data = nullptr;
+        };
+
         static bytes::vector Digest(bytes::const_span data);
 
         static std::array<uint8_t, kSha256Size> Concat(const bytes::memory_span& first, const bytes::memory_span& second);
@@ -30,9 +46,26 @@ namespace openssl {
             std::array<uint8_t, 16> iv;
         };
 
+        // AES-256-CTR state bound once, only the key schedule and counter change per message
+        class Context {
+        public:
+            Context();
+
+            Context(const Context &other) = delete;
+
+            ~Context();
+
+            void processCtr(bytes::memory_span from, void *to, const KeyIv& keyIv) const;
+
+        private:
+            EVP_CIPHER_CTX *_data = nullptr;
+        };
+
         static KeyIv PrepareKeyIv(const uint8_t* key, const uint8_t* msgKey, int x);
 
-        static void ProcessCtr(bytes::memory_span from, void *to, KeyIv& keyIv);
+        static KeyIv PrepareKeyIv(const Sha256::Context& digest, const uint8_t* key, const uint8_t* msgKey, int x);
+
+        static void ProcessCtr(bytes::memory_span from, void *to, const KeyIv& keyIv);
     };
 
 } // openssl
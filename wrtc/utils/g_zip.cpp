@@ -4,76 +4,182 @@
 
 #include "g_zip.hpp"
 
+#include <algorithm>
 #include <vector>
 #include <zlib.h>
 
 namespace bytes {
-    bool GZip::isGzip(const binary& data) {
-        if (data.size() < 2) {
-            return false;
-        }
-        return (data[0] == 0x1f && data[1] == 0x8b) || (data[0] == 0x78 && data[1] == 0x9c);
-    }
+    struct GZip::Streams {
+        z_stream gzip{}, dictionary{}, inflate{};
+        bool gzipReady = false, dictionaryReady = false, inflateReady = false;
 
-    binary GZip::zip(const binary& data) {
-        z_stream stream;
-        stream.zalloc = nullptr;
-        stream.zfree = nullptr;
-        stream.opaque = nullptr;
-        stream.avail_in = static_cast<uint32_t>(data.size());
-        stream.next_in = const_cast<unsigned char*>(data.data());
-        stream.total_out = 0;
-        stream.avail_out = 0;
-        binary output;
-        if (constexpr int compression = 9; deflateInit2(&stream, compression, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
-            output.resize(ChunkSize);
+        ~Streams() {
+            if (gzipReady) {
+                deflateEnd(&gzip);
+            }
+            if (dictionaryReady) {
+                deflateEnd(&dictionary);
+            }
+            if (inflateReady) {
+                inflateEnd(&inflate);
+            }
+        }
 
-            while (stream.avail_out == 0) {
+        static binary deflate(z_stream& stream, const binary& data) {
+            stream.next_in = const_cast<unsigned char*>(data.data());
+            stream.avail_in = static_cast<uint32_t>(data.size());
+            binary output(deflateBound(&stream, static_cast<uLong>(data.size())));
+            int status;
+            do {
                 if (stream.total_out >= output.size()) {
                     output.resize(output.size() + ChunkSize);
                 }
                 stream.next_out = output.data() + stream.total_out;
                 stream.avail_out = static_cast<uint32_t>(output.size() - stream.total_out);
-                deflate(&stream, Z_FINISH);
+                status = ::deflate(&stream, Z_FINISH);
+            } while (status == Z_OK);
+            if (status != Z_STREAM_END) {
+                return {};
             }
-            deflateEnd(&stream);
             output.resize(stream.total_out);
+            return output;
+        }
+    };
+
+    GZip::GZip(const int level, const std::string_view dictionary): streams(std::make_unique<Streams>()), dictionary(dictionary) {
+        streams->gzipReady = deflateInit2(&streams->gzip, level, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        streams->inflateReady = inflateInit2(&streams->inflate, 47) == Z_OK;
+        if (!dictionary.empty()) {
+            dictionaryId = static_cast<uint32_t>(adler32(
+                adler32(0, nullptr, 0),
+                reinterpret_cast<const Bytef*>(dictionary.data()),
+                static_cast<uInt>(dictionary.size())
+            ));
+            streams->dictionaryReady = deflateInit2(&streams->dictionary, level, Z_DEFLATED, 15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
         }
-        return output;
     }
 
-    std::optional<binary> GZip::unzip(const binary& data, const size_t sizeLimit) {
-        z_stream stream;
-        stream.zalloc = nullptr;
-        stream.zfree = nullptr;
-        stream.avail_in = static_cast<uint32_t>(data.size());
-        stream.next_in = const_cast<unsigned char*>(data.data());
-        stream.total_out = 0;
-        stream.avail_out = 0;
+    GZip::~GZip() = default;
+
+    bool GZip::isGzip(const rtc::ArrayView<const uint8_t> data) {
+        if (data.size() < 2) {
+            return false;
+        }
+        if (data[0] == 0x1f && data[1] == 0x8b) {
+            return true;
+        }
+        return data[0] == 0x78 && (data[0] << 8 | data[1]) % 31 == 0;
+    }
+
+    binary GZip::compress(const binary& data) {
+        std::lock_guard lock(deflateMutex);
+        if (remoteDictionary && streams->dictionaryReady) {
+            auto& stream = streams->dictionary;
+            deflateReset(&stream);
+            deflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size()));
+            return Streams::deflate(stream, data);
+        }
+        if (!streams->gzipReady) {
+            return {};
+        }
+        auto& stream = streams->gzip;
+        deflateReset(&stream);
+        gz_header header{};
+        uint8_t extra[8] = {
+            DictionaryTag[0],
+            DictionaryTag[1],
+            4,
+            0,
+            static_cast<uint8_t>(dictionaryId),
+            static_cast<uint8_t>(dictionaryId >> 8),
+            static_cast<uint8_t>(dictionaryId >> 16),
+            static_cast<uint8_t>(dictionaryId >> 24),
+        };
+        if (streams->dictionaryReady) {
+            header.extra = extra;
+            header.extra_len = sizeof(extra);
+            header.os = 255;
+            deflateSetHeader(&stream, &header);
+        }
+        return Streams::deflate(stream, data);
+    }
 
-        binary output;
-        if (inflateInit2(&stream, 47) == Z_OK) {
-            int status = Z_OK;
-            output.resize(data.size() * 2);
-            while (status == Z_OK) {
-                if (sizeLimit > 0 && stream.total_out > sizeLimit) {
+    std::optional<rtc::CopyOnWriteBuffer> GZip::decompress(const rtc::ArrayView<const uint8_t> data, const size_t sizeLimit) {
+        std::lock_guard lock(inflateMutex);
+        if (!streams->inflateReady) {
+            return std::nullopt;
+        }
+        auto& stream = streams->inflate;
+        inflateReset(&stream);
+        gz_header header{};
+        uint8_t extra[32];
+        header.extra = extra;
+        header.extra_max = sizeof(extra);
+        inflateGetHeader(&stream, &header);
+
+        stream.next_in = const_cast<unsigned char*>(data.data());
+        stream.avail_in = static_cast<uint32_t>(data.size());
+        rtc::CopyOnWriteBuffer output(data.size() * 4);
+        while (true) {
+            if (stream.total_out >= output.size()) {
+                output.SetSize(output.size() + ChunkSize);
+            }
+            stream.next_out = output.MutableData() + stream.total_out;
+            stream.avail_out = static_cast<uint32_t>(output.size() - stream.total_out);
+            const int status = inflate(&stream, Z_NO_FLUSH);
+            if (status == Z_NEED_DICT) {
+                if (!streams->dictionaryReady || stream.adler != dictionaryId) {
                     return std::nullopt;
                 }
-                if (stream.total_out >= output.size()) {
-                    output.resize(output.size() + data.size() / 2);
-                }
-                stream.next_out = output.data() + stream.total_out;
-                stream.avail_out = static_cast<uint32_t>(output.size() - stream.total_out);
-                status = inflate(&stream, Z_SYNC_FLUSH);
-            }
-            if (inflateEnd(&stream) == Z_OK) {
-                if (status == Z_STREAM_END) {
-                    output.resize(stream.total_out);
-                } else if (sizeLimit > 0 && output.size() > sizeLimit) {
+                if (inflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size())) != Z_OK) {
                     return std::nullopt;
                 }
+                remoteDictionary = true;
+                continue;
+            }
+            if (sizeLimit > 0 && stream.total_out > sizeLimit) {
+                return std::nullopt;
             }
+            if (status == Z_STREAM_END) {
+                break;
+            }
+            if (status != Z_OK && (status != Z_BUF_ERROR || stream.avail_out != 0)) {
+                return std::nullopt;
+            }
+        }
+        output.SetSize(stream.total_out);
+        if (header.done == 1 && header.extra_len > 0 && advertisesDictionary(extra, std::min<size_t>(header.extra_len, sizeof(extra)))) {
+            remoteDictionary = true;
         }
         return output;
     }
-} // bytes
\ No newline at end of file
+
+    bool GZip::advertisesDictionary(const uint8_t* extra, const size_t size) const {
+        if (!streams->dictionaryReady) {
+            return false;
+        }
+        for (size_t offset = 0; offset + 4 <= size;) {
+            const size_t length = extra[offset + 2] | extra[offset + 3] << 8;
+            if (extra[offset] == DictionaryTag[0] && extra[offset + 1] == DictionaryTag[1] && length == 4 && offset + 8 <= size) {
+                const uint32_t id = extra[offset + 4] | extra[offset + 5] << 8 | extra[offset + 6] << 16 | static_cast<uint32_t>(extra[offset + 7]) << 24;
+                return id == dictionaryId;
+            }
+            offset += 4 + length;
+        }
+        return false;
+    }
+
+    bool GZip::dictionaryNegotiated() const {
+        return remoteDictionary && streams->dictionaryReady;
+    }
+
+    binary GZip::zip(const binary& data) {
+        thread_local GZip gzip;
+        return gzip.compress(data);
+    }
+
+    std::optional<rtc::CopyOnWriteBuffer> GZip::unzip(const rtc::ArrayView<const uint8_t> data, const size_t sizeLimit) {
+        thread_local GZip gzip;
+        return gzip.decompress(data, sizeLimit);
+    }
+} // bytes
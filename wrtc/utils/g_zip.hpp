@@ -3,7 +3,13 @@
 //
 
 #pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <string_view>
+#include <api/array_view.h>
+#include <rtc_base/copy_on_write_buffer.h>
 
 #include "binary.hpp"
 
@@ -11,12 +17,37 @@ namespace bytes {
 
     class GZip {
         static constexpr uint32_t ChunkSize = 16384;
+        static constexpr uint8_t DictionaryTag[2] = {'N', 'D'};
+
+        struct Streams;
+        std::unique_ptr<Streams> streams;
+        std::mutex deflateMutex, inflateMutex;
+        std::string_view dictionary;
+        uint32_t dictionaryId = 0;
+        std::atomic_bool remoteDictionary = false;
+
+        [[nodiscard]] bool advertisesDictionary(const uint8_t* extra, size_t size) const;
+
     public:
-        static bool isGzip(const binary& data);
+        static constexpr int DefaultLevel = 9;
+
+        explicit GZip(int level = DefaultLevel, std::string_view dictionary = {});
+
+        ~GZip();
+
+        // Emits gzip carrying the dictionary id until the remote side shows the same dictionary,
+        // then switches to zlib streams primed with it
+        binary compress(const binary& data);
+
+        std::optional<rtc::CopyOnWriteBuffer> decompress(rtc::ArrayView<const uint8_t> data, size_t sizeLimit);
+
+        [[nodiscard]] bool dictionaryNegotiated() const;
+
+        static bool isGzip(rtc::ArrayView<const uint8_t> data);
 
         static binary zip(const binary& data);
 
-        static std::optional<binary> unzip(const binary& data, size_t sizeLimit);
+        static std::optional<rtc::CopyOnWriteBuffer> unzip(rtc::ArrayView<const uint8_t> data, size_t sizeLimit);
     };
 
 } // bytes
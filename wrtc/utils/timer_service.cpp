@@ -0,0 +1,180 @@
+//
+// Created by Laky64 on 12/09/2024.
+//
+
+#include "timer_service.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <rtc_base/logging.h>
+#include <rtc_base/ref_counted_object.h>
+#include <rtc_base/time_utils.h>
+
+namespace wrtc {
+    std::mutex TimerService::_mutex{};
+    int TimerService::_references = 0;
+    rtc::scoped_refptr<TimerService> TimerService::_default = nullptr;
+
+    TimerService::TimerService(): startMs(rtc::TimeMillis()) {
+        thread = std::thread([this] {
+            run();
+        });
+    }
+
+    TimerService::~TimerService() {
+        {
+            std::lock_guard lock(mutex);
+            running = false;
+        }
+        cv.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    rtc::scoped_refptr<TimerService> TimerService::GetOrCreateDefault() {
+        std::lock_guard lock(_mutex);
+        _references++;
+        if (_references == 1) {
+            _default = rtc::scoped_refptr<TimerService>(new rtc::RefCountedObject<TimerService>());
+        }
+        return _default;
+    }
+
+    void TimerService::UnRef() {
+        std::lock_guard lock(_mutex);
+        _references--;
+        if (!_references) {
+            _default = nullptr;
+        }
+    }
+
+    TimerService::TimerId TimerService::schedule(const webrtc::TimeDelta delay, std::function<void()> callback) {
+        return add(delay.ms(), 0, [callback = std::move(callback)] {
+            callback();
+            return false;
+        });
+    }
+
+    TimerService::TimerId TimerService::schedulePeriodic(const webrtc::TimeDelta interval, std::function<bool()> callback) {
+        return add(interval.ms(), interval.ms(), std::move(callback));
+    }
+
+    void TimerService::cancel(const TimerId id) {
+        std::unique_lock lock(mutex);
+        timers.erase(id);
+        if (std::this_thread::get_id() != thread.get_id()) {
+            cv.wait(lock, [this, id] {
+                return runningId != id;
+            });
+        }
+    }
+
+    TimerService::TimerId TimerService::add(const int64_t delayMs, const int64_t intervalMs, std::function<bool()> callback) {
+        std::lock_guard lock(mutex);
+        const auto id = ++lastId;
+        const int64_t expiry = std::max(currentTick + 1, (rtc::TimeMillis() - startMs + delayMs + TickMs - 1) / TickMs);
+        timers[id] = Timer{
+            expiry,
+            (intervalMs + TickMs - 1) / TickMs,
+            std::move(callback),
+        };
+        insert(id, expiry);
+        cv.notify_all();
+        return id;
+    }
+
+    int64_t TimerService::nowTick() const {
+        return (rtc::TimeMillis() - startMs) / TickMs;
+    }
+
+    void TimerService::insert(const TimerId id, const int64_t expiry) {
+        const int64_t delta = expiry - currentTick;
+        int level = 0;
+        while (level < Levels - 1 && delta >= SlotCount << (SlotBits * level)) {
+            level++;
+        }
+        wheel[level][(expiry >> (SlotBits * level)) & SlotMask].push_back(id);
+    }
+
+    void TimerService::cascade(const int level) {
+        auto& slot = wheel[level][(currentTick >> (SlotBits * level)) & SlotMask];
+        std::vector<TimerId> pending;
+        pending.swap(slot);
+        for (const auto id : pending) {
+            if (const auto it = timers.find(id); it != timers.end()) {
+                insert(id, it->second.expiry);
+            }
+        }
+    }
+
+    void TimerService::advance(std::unique_lock<std::mutex>& lock) {
+        const int64_t targetTick = nowTick();
+        while (running && currentTick < targetTick) {
+            currentTick++;
+            for (int level = 1; level < Levels; level++) {
+                if ((currentTick >> (SlotBits * (level - 1))) & SlotMask) {
+                    break;
+                }
+                cascade(level);
+            }
+            std::vector<TimerId> expired;
+            expired.swap(wheel[0][currentTick & SlotMask]);
+            for (const auto id : expired) {
+                auto it = timers.find(id);
+                if (it == timers.end()) {
+                    continue;
+                }
+                if (it->second.expiry > currentTick) {
+                    insert(id, it->second.expiry);
+                    continue;
+                }
+                auto callback = std::move(it->second.callback);
+                runningId = id;
+                lock.unlock();
+                const bool keep = callback();
+                lock.lock();
+                runningId = 0;
+                cv.notify_all();
+                it = timers.find(id);
+                if (it == timers.end()) {
+                    continue;
+                }
+                if (keep && it->second.interval > 0) {
+                    it->second.callback = std::move(callback);
+                    it->second.expiry = std::max(currentTick + 1, it->second.expiry + it->second.interval);
+                    insert(id, it->second.expiry);
+                } else {
+                    timers.erase(it);
+                }
+            }
+        }
+    }
+
+    int64_t TimerService::nextWakeTick() const {
+        const int64_t boundary = (currentTick | SlotMask) + 1;
+        for (int64_t tick = currentTick + 1; tick < boundary; tick++) {
+            if (!wheel[0][tick & SlotMask].empty()) {
+                return tick;
+            }
+        }
+        return boundary;
+    }
+
+    void TimerService::run() {
+        std::unique_lock lock(mutex);
+        while (running) {
+            advance(lock);
+            if (!running) {
+                break;
+            }
+            if (timers.empty()) {
+                cv.wait(lock);
+            } else {
+                const int64_t waitMs = startMs + nextWakeTick() * TickMs - rtc::TimeMillis();
+                cv.wait_for(lock, std::chrono::milliseconds(std::max<int64_t>(waitMs, 0)));
+            }
+        }
+        RTC_LOG(LS_VERBOSE) << "TimerService stopped with " << timers.size() << " pending timers";
+    }
+} // wrtc
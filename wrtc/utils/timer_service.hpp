@@ -0,0 +1,83 @@
+//
+// Created by Laky64 on 12/09/2024.
+//
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <api/ref_count.h>
+#include <api/scoped_refptr.h>
+#include <api/units/time_delta.h>
+
+namespace wrtc {
+
+    // Hierarchical timer wheel shared by every call, timers expiring within
+    // the same tick are coalesced and fired together by a single thread.
+    class TimerService final : public webrtc::RefCountInterface {
+    public:
+        using TimerId = uint64_t;
+
+        TimerService();
+
+        ~TimerService() override;
+
+        static rtc::scoped_refptr<TimerService> GetOrCreateDefault();
+
+        static void UnRef();
+
+        TimerId schedule(webrtc::TimeDelta delay, std::function<void()> callback);
+
+        TimerId schedulePeriodic(webrtc::TimeDelta interval, std::function<bool()> callback);
+
+        void cancel(TimerId id);
+
+    private:
+        static constexpr int64_t TickMs = 10;
+        static constexpr int SlotBits = 6;
+        static constexpr int64_t SlotCount = 1 << SlotBits;
+        static constexpr int64_t SlotMask = SlotCount - 1;
+        static constexpr int Levels = 4;
+
+        struct Timer {
+            int64_t expiry;
+            int64_t interval;
+            std::function<bool()> callback;
+        };
+
+        static std::mutex _mutex;
+        static int _references;
+        static rtc::scoped_refptr<TimerService> _default;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+        bool running = true;
+        int64_t startMs;
+        int64_t currentTick = 0;
+        TimerId lastId = 0;
+        TimerId runningId = 0;
+        std::unordered_map<TimerId, Timer> timers;
+        std::array<std::array<std::vector<TimerId>, SlotCount>, Levels> wheel;
+
+        TimerId add(int64_t delayMs, int64_t intervalMs, std::function<bool()> callback);
+
+        int64_t nowTick() const;
+
+        void insert(TimerId id, int64_t expiry);
+
+        void cascade(int level);
+
+        void advance(std::unique_lock<std::mutex>& lock);
+
+        int64_t nextWakeTick() const;
+
+        void run();
+    };
+
+} // wrtc
@@ -0,0 +1,71 @@
+//
+// Created by Laky64 on 14/09/2024.
+//
+
+#include "complexity_video_encoder.hpp"
+
+#include <rtc_base/string_to_number.h>
+
+#include "wrtc/models/encoding_profile.hpp"
+
+namespace wrtc {
+    ComplexityVideoEncoder::ComplexityVideoEncoder(std::unique_ptr<VideoEncoder> encoder, const webrtc::VideoCodecComplexity complexity):
+        encoder(std::move(encoder)), complexity(complexity) {}
+
+    std::unique_ptr<webrtc::VideoEncoder> ComplexityVideoEncoder::Wrap(std::unique_ptr<VideoEncoder> encoder, const webrtc::SdpVideoFormat& format) {
+        if (!encoder) {
+            return nullptr;
+        }
+        const auto it = format.parameters.find(kCodecParamComplexity);
+        if (it == format.parameters.end()) {
+            return encoder;
+        }
+        const auto value = rtc::StringToNumber<int>(it->second);
+        if (!value) {
+            return encoder;
+        }
+        return std::make_unique<ComplexityVideoEncoder>(std::move(encoder), static_cast<webrtc::VideoCodecComplexity>(*value));
+    }
+
+    void ComplexityVideoEncoder::SetFecControllerOverride(webrtc::FecControllerOverride* fec_controller_override) {
+        encoder->SetFecControllerOverride(fec_controller_override);
+    }
+
+    int32_t ComplexityVideoEncoder::InitEncode(const webrtc::VideoCodec* codec_settings, const Settings& settings) {
+        webrtc::VideoCodec codec = *codec_settings;
+        codec.SetVideoEncoderComplexity(complexity);
+        return encoder->InitEncode(&codec, settings);
+    }
+
+    int32_t ComplexityVideoEncoder::RegisterEncodeCompleteCallback(webrtc::EncodedImageCallback* callback) {
+        return encoder->RegisterEncodeCompleteCallback(callback);
+    }
+
+    int32_t ComplexityVideoEncoder::Release() {
+        return encoder->Release();
+    }
+
+    int32_t ComplexityVideoEncoder::Encode(const webrtc::VideoFrame& frame, const std::vector<webrtc::VideoFrameType>* frame_types) {
+        return encoder->Encode(frame, frame_types);
+    }
+
+    void ComplexityVideoEncoder::SetRates(const RateControlParameters& parameters) {
+        encoder->SetRates(parameters);
+    }
+
+    void ComplexityVideoEncoder::OnPacketLossRateUpdate(const float packet_loss_rate) {
+        encoder->OnPacketLossRateUpdate(packet_loss_rate);
+    }
+
+    void ComplexityVideoEncoder::OnRttUpdate(const int64_t rtt_ms) {
+        encoder->OnRttUpdate(rtt_ms);
+    }
+
+    void ComplexityVideoEncoder::OnLossNotification(const LossNotification& loss_notification) {
+        encoder->OnLossNotification(loss_notification);
+    }
+
+    webrtc::VideoEncoder::EncoderInfo ComplexityVideoEncoder::GetEncoderInfo() const {
+        return encoder->GetEncoderInfo();
+    }
+} // wrtc
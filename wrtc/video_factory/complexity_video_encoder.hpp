@@ -0,0 +1,42 @@
+//
+// Created by Laky64 on 14/09/2024.
+//
+
+#pragma once
+
+#include <api/video_codecs/video_codec.h>
+#include <api/video_codecs/video_encoder.h>
+
+namespace wrtc {
+
+    class ComplexityVideoEncoder final : public webrtc::VideoEncoder {
+        std::unique_ptr<VideoEncoder> encoder;
+        webrtc::VideoCodecComplexity complexity;
+
+    public:
+        ComplexityVideoEncoder(std::unique_ptr<VideoEncoder> encoder, webrtc::VideoCodecComplexity complexity);
+
+        static std::unique_ptr<VideoEncoder> Wrap(std::unique_ptr<VideoEncoder> encoder, const webrtc::SdpVideoFormat& format);
+
+        void SetFecControllerOverride(webrtc::FecControllerOverride* fec_controller_override) override;
+
+        int32_t InitEncode(const webrtc::VideoCodec* codec_settings, const Settings& settings) override;
+
+        int32_t RegisterEncodeCompleteCallback(webrtc::EncodedImageCallback* callback) override;
+
+        int32_t Release() override;
+
+        int32_t Encode(const webrtc::VideoFrame& frame, const std::vector<webrtc::VideoFrameType>* frame_types) override;
+
+        void SetRates(const RateControlParameters& parameters) override;
+
+        void OnPacketLossRateUpdate(float packet_loss_rate) override;
+
+        void OnRttUpdate(int64_t rtt_ms) override;
+
+        void OnLossNotification(const LossNotification& loss_notification) override;
+
+        EncoderInfo GetEncoderInfo() const override;
+    };
+
+} // wrtc
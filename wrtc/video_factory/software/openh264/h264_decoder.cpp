@@ -0,0 +1,99 @@
+//
+// Created by Laky64 on 16/09/2024.
+//
+
+#include "h264_decoder.hpp"
+
+#ifdef OPENH264_ENABLED
+#include <api/video/i420_buffer.h>
+#include <modules/video_coding/include/video_error_codes.h>
+#include <rtc_base/logging.h>
+
+namespace openh264 {
+    H264Decoder::~H264Decoder() {
+        H264Decoder::Release();
+    }
+
+    bool H264Decoder::Configure(const Settings& settings) {
+        Release();
+        if (WelsCreateDecoder(&decoder) != 0 || !decoder) {
+            RTC_LOG(LS_ERROR) << "Failed to create OpenH264 decoder";
+            return false;
+        }
+        SDecodingParam param{};
+        param.sVideoProperty.eVideoBsType = VIDEO_BITSTREAM_AVC;
+        param.eEcActiveIdc = ERROR_CON_DISABLE;
+        if (decoder->Initialize(&param) != cmResultSuccess) {
+            RTC_LOG(LS_ERROR) << "Failed to initialize OpenH264 decoder";
+            Release();
+            return false;
+        }
+        return true;
+    }
+
+    int32_t H264Decoder::Decode(const webrtc::EncodedImage& input_image, int64_t) {
+        if (!decoder || !callback) {
+            return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+        }
+        if (!input_image.data() || !input_image.size()) {
+            return WEBRTC_VIDEO_CODEC_ERR_PARAMETER;
+        }
+        uint8_t* planes[3] = {};
+        SBufferInfo info{};
+        if (decoder->DecodeFrameNoDelay(input_image.data(), static_cast<int>(input_image.size()), planes, &info) != dsErrorFree) {
+            return WEBRTC_VIDEO_CODEC_ERROR;
+        }
+        if (info.iBufferStatus != 1) {
+            return WEBRTC_VIDEO_CODEC_OK;
+        }
+        const auto& systemBuffer = info.UsrData.sSystemBuffer;
+        const auto buffer = webrtc::I420Buffer::Copy(
+            systemBuffer.iWidth,
+            systemBuffer.iHeight,
+            planes[0],
+            systemBuffer.iStride[0],
+            planes[1],
+            systemBuffer.iStride[1],
+            planes[2],
+            systemBuffer.iStride[1]
+        );
+        parser.ParseBitstream(input_image);
+        absl::optional<uint8_t> qp;
+        if (const auto lastQp = parser.GetLastSliceQp()) {
+            qp = static_cast<uint8_t>(*lastQp);
+        }
+        auto frame = webrtc::VideoFrame::Builder()
+            .set_video_frame_buffer(buffer)
+            .set_rtp_timestamp(input_image.RtpTimestamp())
+            .set_color_space(input_image.ColorSpace())
+            .build();
+        callback->Decoded(frame, absl::nullopt, qp);
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    int32_t H264Decoder::RegisterDecodeCompleteCallback(webrtc::DecodedImageCallback* decodeCallback) {
+        callback = decodeCallback;
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    int32_t H264Decoder::Release() {
+        if (decoder) {
+            decoder->Uninitialize();
+            WelsDestroyDecoder(decoder);
+            decoder = nullptr;
+        }
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    webrtc::VideoDecoder::DecoderInfo H264Decoder::GetDecoderInfo() const {
+        DecoderInfo info;
+        info.implementation_name = ImplementationName();
+        info.is_hardware_accelerated = false;
+        return info;
+    }
+
+    const char* H264Decoder::ImplementationName() const {
+        return "OpenH264";
+    }
+} // openh264
+#endif
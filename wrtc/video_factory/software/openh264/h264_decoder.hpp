@@ -0,0 +1,38 @@
+//
+// Created by Laky64 on 16/09/2024.
+//
+
+#pragma once
+
+#ifdef OPENH264_ENABLED
+#include <api/video_codecs/video_decoder.h>
+#include <common_video/h264/h264_bitstream_parser.h>
+#include <wels/codec_api.h>
+
+namespace openh264 {
+
+    class H264Decoder final : public webrtc::VideoDecoder {
+        ISVCDecoder* decoder = nullptr;
+        webrtc::DecodedImageCallback* callback = nullptr;
+        webrtc::H264BitstreamParser parser;
+
+    public:
+        H264Decoder() = default;
+
+        ~H264Decoder() override;
+
+        bool Configure(const Settings& settings) override;
+
+        int32_t Decode(const webrtc::EncodedImage& input_image, int64_t render_time_ms) override;
+
+        int32_t RegisterDecodeCompleteCallback(webrtc::DecodedImageCallback* decodeCallback) override;
+
+        int32_t Release() override;
+
+        DecoderInfo GetDecoderInfo() const override;
+
+        const char* ImplementationName() const override;
+    };
+
+} // openh264
+#endif
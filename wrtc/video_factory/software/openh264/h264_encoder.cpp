@@ -0,0 +1,245 @@
+//
+// Created by Laky64 on 16/09/2024.
+//
+
+#include "h264_encoder.hpp"
+
+#ifdef OPENH264_ENABLED
+#include <algorithm>
+#include <cstring>
+#include <api/video_codecs/h264_profile_level_id.h>
+#include <media/base/media_constants.h>
+#include <modules/video_coding/include/video_codec_interface.h>
+#include <modules/video_coding/include/video_error_codes.h>
+#include <rtc_base/logging.h>
+
+namespace openh264 {
+    H264Encoder::H264Encoder(const webrtc::SdpVideoFormat& format) {
+        const auto mode = format.parameters.find(cricket::kH264FmtpPacketizationMode);
+        packetizationMode = mode != format.parameters.end() && mode->second == "1" ? webrtc::H264PacketizationMode::NonInterleaved : webrtc::H264PacketizationMode::SingleNalUnit;
+        if (const auto profileLevelId = webrtc::ParseSdpForH264ProfileLevelId(format.parameters)) {
+            level = profileLevelId->level == webrtc::H264Level::kLevel1_b ? LEVEL_1_B : static_cast<ELevelIdc>(profileLevelId->level);
+        }
+    }
+
+    H264Encoder::~H264Encoder() {
+        H264Encoder::Release();
+    }
+
+    int32_t H264Encoder::InitEncode(const webrtc::VideoCodec* codec_settings, const Settings& settings) {
+        if (!codec_settings || codec_settings->codecType != webrtc::kVideoCodecH264 || codec_settings->width < 1 || codec_settings->height < 1) {
+            return WEBRTC_VIDEO_CODEC_ERR_PARAMETER;
+        }
+        codec = *codec_settings;
+        numberOfCores = settings.number_of_cores;
+        maxPayloadSize = settings.max_payload_size;
+        targetBitrate = static_cast<int>(codec.startBitrate) * 1000;
+        framerate = static_cast<float>(codec.maxFramerate);
+        return initialize();
+    }
+
+    int32_t H264Encoder::initialize() {
+        Release();
+        if (WelsCreateSVCEncoder(&encoder) != 0 || !encoder) {
+            RTC_LOG(LS_ERROR) << "Failed to create OpenH264 encoder";
+            return WEBRTC_VIDEO_CODEC_ERROR;
+        }
+        SEncParamExt param;
+        encoder->GetDefaultParams(&param);
+        param.iUsageType = codec.mode == webrtc::VideoCodecMode::kScreensharing ? SCREEN_CONTENT_REAL_TIME : CAMERA_VIDEO_REAL_TIME;
+        param.iPicWidth = codec.width;
+        param.iPicHeight = codec.height;
+        param.iTargetBitrate = targetBitrate;
+        param.iMaxBitrate = codec.maxBitrate ? static_cast<int>(codec.maxBitrate) * 1000 : UNSPECIFIED_BIT_RATE;
+        param.iRCMode = RC_BITRATE_MODE;
+        param.fMaxFrameRate = framerate;
+        param.bEnableFrameSkip = true;
+        param.uiIntraPeriod = codec.H264().keyFrameInterval;
+        param.eSpsPpsIdStrategy = CONSTANT_ID;
+        param.bEnableDenoise = false;
+        param.bEnableAdaptiveQuant = true;
+        param.bEnableBackgroundDetection = true;
+        param.bEnableSceneChangeDetect = true;
+        param.iMultipleThreadIdc = numberOfThreads();
+        switch (codec.GetVideoEncoderComplexity()) {
+        case webrtc::VideoCodecComplexity::kComplexityLow:
+            param.iComplexityMode = LOW_COMPLEXITY;
+            break;
+        case webrtc::VideoCodecComplexity::kComplexityNormal:
+            param.iComplexityMode = MEDIUM_COMPLEXITY;
+            break;
+        default:
+            param.iComplexityMode = HIGH_COMPLEXITY;
+            break;
+        }
+        param.iSpatialLayerNum = 1;
+        param.iTemporalLayerNum = 1;
+        auto& layer = param.sSpatialLayers[0];
+        layer.iVideoWidth = codec.width;
+        layer.iVideoHeight = codec.height;
+        layer.fFrameRate = framerate;
+        layer.iSpatialBitrate = param.iTargetBitrate;
+        layer.iMaxSpatialBitrate = param.iMaxBitrate;
+        layer.uiProfileIdc = PRO_BASELINE;
+        layer.uiLevelIdc = level;
+        if (packetizationMode == webrtc::H264PacketizationMode::SingleNalUnit) {
+            layer.sSliceArgument.uiSliceMode = SM_SIZELIMITED_SLICE;
+            layer.sSliceArgument.uiSliceSizeConstraint = static_cast<unsigned int>(maxPayloadSize);
+        } else {
+            layer.sSliceArgument.uiSliceMode = SM_FIXEDSLCNUM_SLICE;
+            layer.sSliceArgument.uiSliceNum = param.iMultipleThreadIdc;
+        }
+        if (encoder->InitializeExt(&param) != 0) {
+            RTC_LOG(LS_ERROR) << "Failed to initialize OpenH264 encoder";
+            Release();
+            return WEBRTC_VIDEO_CODEC_ERROR;
+        }
+        int videoFormat = videoFormatI420;
+        encoder->SetOption(ENCODER_OPTION_DATAFORMAT, &videoFormat);
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    int H264Encoder::numberOfThreads() const {
+        const int pixels = codec.width * codec.height;
+        if (pixels >= 1920 * 1080 && numberOfCores > 8) {
+            return 8;
+        }
+        if (pixels > 1280 * 720 && numberOfCores >= 6) {
+            return 3;
+        }
+        if (pixels > 640 * 480 && numberOfCores >= 3) {
+            return 2;
+        }
+        return 1;
+    }
+
+    int32_t H264Encoder::RegisterEncodeCompleteCallback(webrtc::EncodedImageCallback* encodeCallback) {
+        callback = encodeCallback;
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    int32_t H264Encoder::Release() {
+        if (encoder) {
+            encoder->Uninitialize();
+            WelsDestroySVCEncoder(encoder);
+            encoder = nullptr;
+        }
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    int32_t H264Encoder::Encode(const webrtc::VideoFrame& frame, const std::vector<webrtc::VideoFrameType>* frame_types) {
+        if (!encoder || !callback) {
+            return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+        }
+        if (paused) {
+            return WEBRTC_VIDEO_CODEC_OK;
+        }
+        const auto buffer = frame.video_frame_buffer()->ToI420();
+        if (!buffer) {
+            return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
+        }
+        if (buffer->width() != codec.width || buffer->height() != codec.height) {
+            codec.width = static_cast<uint16_t>(buffer->width());
+            codec.height = static_cast<uint16_t>(buffer->height());
+            if (const auto result = initialize(); result != WEBRTC_VIDEO_CODEC_OK) {
+                return result;
+            }
+        }
+        if (frame_types && std::ranges::find(*frame_types, webrtc::VideoFrameType::kVideoFrameKey) != frame_types->end()) {
+            encoder->ForceIntraFrame(true);
+        }
+
+        SSourcePicture picture{};
+        picture.iPicWidth = buffer->width();
+        picture.iPicHeight = buffer->height();
+        picture.iColorFormat = videoFormatI420;
+        picture.uiTimeStamp = frame.ntp_time_ms();
+        picture.iStride[0] = buffer->StrideY();
+        picture.iStride[1] = buffer->StrideU();
+        picture.iStride[2] = buffer->StrideV();
+        picture.pData[0] = const_cast<uint8_t*>(buffer->DataY());
+        picture.pData[1] = const_cast<uint8_t*>(buffer->DataU());
+        picture.pData[2] = const_cast<uint8_t*>(buffer->DataV());
+
+        SFrameBSInfo info{};
+        if (encoder->EncodeFrame(&picture, &info) != cmResultSuccess) {
+            RTC_LOG(LS_ERROR) << "OpenH264 failed to encode frame";
+            return WEBRTC_VIDEO_CODEC_ERROR;
+        }
+        if (info.eFrameType == videoFrameTypeSkip || info.eFrameType == videoFrameTypeInvalid) {
+            return WEBRTC_VIDEO_CODEC_OK;
+        }
+
+        size_t size = 0;
+        for (int i = 0; i < info.iLayerNum; i++) {
+            const auto& layerInfo = info.sLayerInfo[i];
+            for (int j = 0; j < layerInfo.iNalCount; j++) {
+                size += layerInfo.pNalLengthInByte[j];
+            }
+        }
+        const auto encodedData = webrtc::EncodedImageBuffer::Create(size);
+        size_t offset = 0;
+        for (int i = 0; i < info.iLayerNum; i++) {
+            const auto& layerInfo = info.sLayerInfo[i];
+            size_t layerSize = 0;
+            for (int j = 0; j < layerInfo.iNalCount; j++) {
+                layerSize += layerInfo.pNalLengthInByte[j];
+            }
+            memcpy(encodedData->data() + offset, layerInfo.pBsBuf, layerSize);
+            offset += layerSize;
+        }
+
+        const bool isKeyFrame = info.eFrameType == videoFrameTypeIDR;
+        webrtc::EncodedImage image;
+        image.SetEncodedData(encodedData);
+        image._encodedWidth = buffer->width();
+        image._encodedHeight = buffer->height();
+        image.SetRtpTimestamp(frame.rtp_timestamp());
+        image.SetColorSpace(frame.color_space());
+        image.capture_time_ms_ = frame.render_time_ms();
+        image.rotation_ = frame.rotation();
+        image.content_type_ = codec.mode == webrtc::VideoCodecMode::kScreensharing ? webrtc::VideoContentType::SCREENSHARE : webrtc::VideoContentType::UNSPECIFIED;
+        image._frameType = isKeyFrame ? webrtc::VideoFrameType::kVideoFrameKey : webrtc::VideoFrameType::kVideoFrameDelta;
+        parser.ParseBitstream(image);
+        image.qp_ = parser.GetLastSliceQp().value_or(-1);
+
+        webrtc::CodecSpecificInfo codecInfo;
+        codecInfo.codecType = webrtc::kVideoCodecH264;
+        codecInfo.codecSpecific.H264.packetization_mode = packetizationMode;
+        codecInfo.codecSpecific.H264.temporal_idx = webrtc::kNoTemporalIdx;
+        codecInfo.codecSpecific.H264.idr_frame = isKeyFrame;
+        codecInfo.codecSpecific.H264.base_layer_sync = false;
+        callback->OnEncodedImage(image, &codecInfo);
+        return WEBRTC_VIDEO_CODEC_OK;
+    }
+
+    void H264Encoder::SetRates(const RateControlParameters& parameters) {
+        if (!encoder) {
+            return;
+        }
+        if (parameters.bitrate.get_sum_bps() == 0) {
+            paused = true;
+            return;
+        }
+        paused = false;
+        targetBitrate = static_cast<int>(parameters.bitrate.get_sum_bps());
+        framerate = static_cast<float>(parameters.framerate_fps);
+        SBitrateInfo bitrate{};
+        bitrate.iLayer = SPATIAL_LAYER_ALL;
+        bitrate.iBitrate = targetBitrate;
+        encoder->SetOption(ENCODER_OPTION_BITRATE, &bitrate);
+        encoder->SetOption(ENCODER_OPTION_FRAME_RATE, &framerate);
+    }
+
+    webrtc::VideoEncoder::EncoderInfo H264Encoder::GetEncoderInfo() const {
+        EncoderInfo info;
+        info.supports_native_handle = false;
+        info.implementation_name = "OpenH264";
+        info.scaling_settings = ScalingSettings(24, 37);
+        info.is_hardware_accelerated = false;
+        info.supports_simulcast = false;
+        info.preferred_pixel_formats = {webrtc::VideoFrameBuffer::Type::kI420};
+        return info;
+    }
+} // openh264
+#endif
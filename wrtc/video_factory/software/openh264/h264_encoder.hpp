@@ -0,0 +1,52 @@
+//
+// Created by Laky64 on 16/09/2024.
+//
+
+#pragma once
+
+#ifdef OPENH264_ENABLED
+#include <api/video_codecs/sdp_video_format.h>
+#include <api/video_codecs/video_encoder.h>
+#include <common_video/h264/h264_bitstream_parser.h>
+#include <modules/video_coding/codecs/h264/include/h264_globals.h>
+#include <wels/codec_api.h>
+
+namespace openh264 {
+
+    class H264Encoder final : public webrtc::VideoEncoder {
+        ISVCEncoder* encoder = nullptr;
+        webrtc::EncodedImageCallback* callback = nullptr;
+        webrtc::H264PacketizationMode packetizationMode;
+        ELevelIdc level = LEVEL_3_1;
+        webrtc::VideoCodec codec{};
+        int numberOfCores = 1;
+        size_t maxPayloadSize = 0;
+        int targetBitrate = 0;
+        float framerate = 0;
+        bool paused = false;
+        webrtc::H264BitstreamParser parser;
+
+        int32_t initialize();
+
+        int numberOfThreads() const;
+
+    public:
+        explicit H264Encoder(const webrtc::SdpVideoFormat& format);
+
+        ~H264Encoder() override;
+
+        int32_t InitEncode(const webrtc::VideoCodec* codec_settings, const Settings& settings) override;
+
+        int32_t RegisterEncodeCompleteCallback(webrtc::EncodedImageCallback* encodeCallback) override;
+
+        int32_t Release() override;
+
+        int32_t Encode(const webrtc::VideoFrame& frame, const std::vector<webrtc::VideoFrameType>* frame_types) override;
+
+        void SetRates(const RateControlParameters& parameters) override;
+
+        EncoderInfo GetEncoderInfo() const override;
+    };
+
+} // openh264
+#endif
@@ -0,0 +1,36 @@
+//
+// Created by Laky64 on 16/09/2024.
+//
+
+#include "openh264.hpp"
+
+#ifdef OPENH264_ENABLED
+#include "h264_decoder.hpp"
+#include "h264_encoder.hpp"
+#endif
+
+namespace openh264 {
+
+    void addEncoders(std::vector<wrtc::VideoEncoderConfig> &encoders) {
+#ifdef OPENH264_ENABLED
+        encoders.emplace_back(
+            webrtc::kVideoCodecH264,
+            [](const webrtc::SdpVideoFormat& format) {
+                return std::make_unique<H264Encoder>(format);
+            }
+        );
+#endif
+    }
+
+    void addDecoders(std::vector<wrtc::VideoDecoderConfig> &decoders) {
+#ifdef OPENH264_ENABLED
+        decoders.emplace_back(
+            webrtc::kVideoCodecH264,
+            [](auto) {
+                return std::make_unique<H264Decoder>();
+            }
+        );
+#endif
+    }
+
+} // openh264
@@ -0,0 +1,16 @@
+//
+// Created by Laky64 on 16/09/2024.
+//
+
+#pragma once
+
+#include "../../video_encoder_config.hpp"
+#include "../../video_decoder_config.hpp"
+
+namespace openh264 {
+
+    void addEncoders(std::vector<wrtc::VideoEncoderConfig> &encoders);
+
+    void addDecoders(std::vector<wrtc::VideoDecoderConfig> &decoders);
+
+} // openh264
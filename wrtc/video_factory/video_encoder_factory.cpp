@@ -4,6 +4,8 @@
 
 #include "video_encoder_factory.hpp"
 
+#include "complexity_video_encoder.hpp"
+
 namespace wrtc {
     // TODO: Needed template like this:
     // https://github.com/pytgcalls/ntgcalls/blob/85ee93f72f223405174759b23eb222373e0bc775/wrtc/video_factory/base_video_factory.cpp
@@ -13,7 +15,7 @@ namespace wrtc {
         for (const auto& enc : encoders) {
             for (auto supported_formats = formats_[n++]; const auto& f : supported_formats) {
                 if (f.IsSameCodec(format)) {
-                    return enc.CreateVideoCodec(env, format);
+                    return ComplexityVideoEncoder::Wrap(enc.CreateVideoCodec(env, format), format);
                 }
             }
         }
@@ -4,6 +4,7 @@
 
 #include "video_factory_config.hpp"
 
+#include "software/openh264/openh264.hpp"
 #include "software/vlc/vlc.hpp"
 
 namespace wrtc {
@@ -17,6 +18,10 @@ namespace wrtc {
         vlc::addEncoders(encoders);
         vlc::addDecoders(decoders);
 
+        // OpenH264 (Software, H264)
+        openh264::addEncoders(encoders);
+        openh264::addDecoders(decoders);
+
         // NVCODEC (Hardware, VP8, VP9, H264)
         // TODO: @Laky-64 Add NVCODEC encoder-decoder when available
     }